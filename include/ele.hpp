@@ -138,8 +138,16 @@ public:
   vector<double> getBoundingBox(void);
 
   /*! Find the reference location of a point inside an element given its
-   *  physical location, using the Newton root-finding method */
-  bool getRefLocNewton(point pos, point& loc);
+   *  physical location, using the Newton root-finding method
+   *  [If useGuess, the incoming value of loc is used as the initial guess] */
+  bool getRefLocNewton(point pos, point& loc, bool useGuess = false);
+
+  /*! Batched getRefLocNewton for many (point, candidate element) pairs, done in parallel
+   *  [eleIDs index into eles; isInEle[k] is set for each pair k]
+   *  If given, pairs ptStart[i] to ptStart[i+1] are the candidates of one point, and
+   *  only the first which contains it is flagged [the rest aren't tested] */
+  static void getRefLocNewtonBatch(vector<shared_ptr<ele>> &eles, const vector<int> &eleIDs, const vector<point> &pos,
+                                   vector<point> &loc, vector<char> &isInEle, const vector<int> &ptStart = vector<int>());
 
   /*! Find the reference location of a point inside an element given its
    *  physical location, using the Nelder-Meade algorithm */
@@ -207,18 +215,18 @@ public:
 
   /*! ==== TRANSITION TO GLOBAL SOLUTION STORAGE ==== */
   double& U_spts(int spt, int field);
-  double& F_spts(int dim, int spt, int field);
+  flux_t& F_spts(int dim, int spt, int field);
   double& dU_spts(int dim, int spt, int field);
-  double& dF_spts(int dim_grad, int dim_flux, int spt, int field);
+  flux_t& dF_spts(int dim_grad, int dim_flux, int spt, int field);
   double& U_fpts(int fpt, int field);
   double& F_fpts(int dim, int fpt, int field);
   double& Fn_fpts(int fpt, int field);
-  double& disFn_fpts(int fpt, int field);
+  flux_t& disFn_fpts(int fpt, int field);
   double& U_mpts(int mpt, int field);
   double& V_ppts(int ppt, int field);
   double& dU_fpts(int dim, int fpt, int field);
   double& dUc_fpts(int fpt, int field);
-  double& divF_spts(int step, int spt, int field);
+  flux_t& divF_spts(int step, int spt, int field);
 
   double& shape_spts(int spt, int node);
   double& shape_fpts(int fpt, int node);
@@ -229,6 +237,7 @@ public:
   double& detJac_spts(int spt);
   double& detJac_fpts(int fpt);
   double& dA_fpts(int fpt);
+  double& waveSp_faces(int face);
   double& Jac_spts(int spt, int dim1, int dim2);
   double& Jac_fpts(int fpt, int dim1, int dim2);
   double& JGinv_spts(int spt, int dim1, int dim2);
@@ -252,6 +261,7 @@ public:
 private:
 
   double dt;  //! CFL-based dt for element
+  double dtNext;  //! Local dt from the latest flux evaluation, applied at the next solver::calcDt
 
   /*! Get the values of the nodal shape bases at a solution point */
   void getShape(point loc, vector<double> &shape);
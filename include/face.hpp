@@ -161,6 +161,8 @@ public:
   matrix<double> normL;   //! Unit outward normal at flux points
   vector<double> dAL;     //! Local face-area equivalent (aka edge Jacobian) at flux points
   vector<double*> waveSp; //! Maximum numerical wave speed at flux point (in left ele's memory)
+  double* waveSpFaceL;    //! Wave speed integrated over the face (in left ele's memory) [for CFL-based dt]
+  vector<double> wtsFace; //! Quadrature weights at the face's flux points
 
   //! Temporary vectors for calculating common flux
   double tempFL[3][5], tempFR[3][5];
@@ -39,6 +39,18 @@ vector<double> solveCholesky(matrix<double> A, vector<double> b);
 
 matrix<double> solveCholesky(matrix<double> A, matrix<double> &B);
 
+//! Replace the lower triangle of the SPD matrix A with its Cholesky factor G [A = G*G^T]
+void choleskyFactor(matrix<double> &A);
+
+//! Using the Cholesky factor G from choleskyFactor, solve G*G^T*X = B in place [B is overwritten by X]
+void choleskySolve(matrix<double> &G, matrix<double> &B);
+
+//! Whether grid gridID only moves rigidly [or not at all] under the current motion type, so its cells never deform
+bool isRigidMotion(input *params, int gridID);
+
+//! Split nproc MPI ranks between tasks in proportion to their cost [at least 1 rank each; largest remainder]
+vector<int> splitProcsByCost(const vector<double> &cost, int nproc);
+
 /* ---- Nodal Shape Functions ---- */
 
 //! Shape function for linear or quadratic quad (TODO: Generalize to N-noded quad)
@@ -29,6 +29,7 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -87,9 +88,18 @@ public:
   //! Read essential connectivity from a Gmsh mesh file
   void readGmsh(string fileName);
 
+  //! Count the fluid cells & overset-boundary faces in a Gmsh mesh file [without storing the mesh]
+  void countGmshCells(string fileName, int &nCells, int &nOverFaces);
+
   //! Create a simple Cartesian mesh from input parameters
   void createMesh();
 
+  //! Load this rank's pre-processed mesh from its cache file; false if missing or out of date
+  bool readMeshCache(void);
+
+  //! Write this rank's pre-processed mesh [connectivity & partition] to its cache file
+  void writeMeshCache(void);
+
   //! Update connectivity / node-blanking for overset grids
   void setupOverset3D(void);
 
@@ -97,7 +107,8 @@ public:
    * \brief Call TIOGA to re-process overset connectivity
    *
    * Called once during pre-processing by default; re-call each iteration
-   * for moving-mesh cases
+   * for moving-mesh cases.  In 2D, the ADT is refit in place for deforming
+   * grids, and only offset for rigidly-translating grids.
    */
   void updateADT();
 
@@ -148,7 +159,8 @@ public:
   point maxPt;     //! Overall x,y,z extents (max-min) of grid partition
 
   // Additional Connectivity Data
-  matrix<int> c2e, c2b, e2c, e2v, v2e, v2v, v2c;
+  matrix<int> c2e, c2b, e2c, e2v, v2c;
+  vector<int> v2v, v2e, v2vPtr;  //! Vertex-to-vertex & vertex-to-edge adjacency [CSR: row iv is v2vPtr[iv] to v2vPtr[iv+1]]
   matrix<int> c2f, f2v, f2c, c2c, c2ac;
   vector<int> v2nv, v2nc, c2nv, c2nf, f2nv, ctype;
   vector<int> intFaces, bndFaces, mpiFaces, mpiCells;
@@ -168,6 +180,7 @@ public:
   vector<int> gIC_R;             //! The global cell ID of the right cell on the opposite processor
   vector<int> mpiLocF;           //! Element-local face ID of MPI Face in left cell
   vector<int> mpiLocF_R;         //! Element-local face ID of MPI Face in right cell
+  vector<int> mpiRelRot;         //! Relative rotation of each MPI face [3D; set when writing/reading a mesh cache]
   vector<int> mpiPeriodic;       //! Flag for whether an MPI face is also a periodic face
   vector<int> faceType;          //! Type for each face: hole, internal, boundary, MPI, overset [-1,0,1,2,3]
 
@@ -221,16 +234,22 @@ public:
 
   matrix<double> eleBBox;
 
+  //! Compute the bounding box of every element [into eleBBox] from the current vertex positions
+  void calcEleBBox(void);
+
   void setIterIblanks(void);
   void setIblankEles(vector<int>& iblankVert, vector<int>& iblankEle);
   void refineGrid2D(geo &outGrid, int nLevels, int shapeOrder);
 
-  //! Get the partitions from METIS, but do not spilt the grid yet
+  //! Get the mesh partitions [METIS or geometric], but do not spilt the grid yet
   void getMpiPartitions(void);
 
   //! Use existing epart data to partition grid
   void partitionFromEpart(const vector<int>& _epart);
 
+  //! Rebuild this grid's partition from a running geo [moving overset grids], re-cutting the grid if requested
+  void setupRebalance(geo &old, bool repartition);
+
 private:
 
   input *params;
@@ -245,11 +264,28 @@ private:
   vector<int> nBndPts_g; //! Global number of points on each boundary
   map<int,int> bcIdMap;  //! Map from Gmsh boundary ID to Flurry BC ID
   int nEles_g, nVerts_g;
+  vector<int> eleWeights; //! Global cell weights for the partitioners [empty: uniform]
 
   void processConn2D(void);
   void processConn3D(void);
   void processConnExtra(void);
 
+  //! Sort the unique faces into internal & boundary faces, given the face of each cell-face [iF]
+  void setFaceTypes(const vector<int> &iF);
+
+  //! Match each boundary face to the boundary containing all of its nodes
+  void matchBoundaryFaces(void);
+
+  //! Setup the initial positions & velocities of the vertices for moving grids
+  void setupMeshMotion(void);
+
+  //! Name of this rank's mesh cache file, and hashes of the mesh file & the inputs which affect it
+  string meshCacheName(void);
+  void getMeshCacheHashes(void);
+
+  uint64_t meshFileHash = 0;  //! Hash of the mesh file [computed on rank 0 & broadcast]
+  uint64_t meshOptsHash = 0;  //! Hash of this rank's mesh-related inputs
+
   void setupOverset2D(void);
 
   //! Using Tioga's nodal iblanks, set iblank values for all cells and faces
@@ -273,12 +309,18 @@ private:
   //! Compare the orientation (rotation in ref. space) betwen the local faces of 2 elements across MPI boundary
   int compareOrientationMPI(int ic1, int ic2, int f1, int f2, int isPeriodic);
 
-  //! For overset cases, balance MPI processes across grids by # of elements
+  //! For overset cases, balance MPI processes across grids using an estimate of each grid's cost
   void splitGridProcs(void);
 
   //! For MPI runs, partition the mesh across all processors
   void partitionMesh(void);
 
+  //! Get epart from METIS's partitioning of the mesh's dual graph
+  void partitionMetis(void);
+
+  //! Get epart from the element centroids [recursive coordinate bisection or Hilbert-curve ordering]
+  void partitionGeometric(void);
+
   //! For MPI runs, match internal faces across MPI boundaries
   void matchMPIFaces();
 
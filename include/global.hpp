@@ -29,6 +29,7 @@
 #pragma once
 
 #include <limits.h>
+#include <limits>
 #include <cmath>
 #include <chrono>
 #include <iostream>
@@ -67,6 +68,14 @@ using namespace std;
 
 typedef unsigned int uint;
 
+/*! Storage type for the fluxes & flux divergence [single precision with _MIXED_PRECISION;
+ *  the solution and the RK update always remain in double precision] */
+#ifdef _MIXED_PRECISION
+typedef float flux_t;
+#else
+typedef double flux_t;
+#endif
+
 /* --- Misc. Common Constants / Globally-Useful Variables --- */
 
 static double pi = 4.0*atan(1);
@@ -107,6 +116,13 @@ enum meshType {
   OVERSET_MESH = 2
 };
 
+/*! Enumeration for the mesh partitioner used for MPI runs */
+enum PARTITION_TYPE {
+  METIS_PART   = 0,
+  RCB_PART     = 1,
+  HILBERT_PART = 2
+};
+
 enum EQUATION {
   ADVECTION_DIFFUSION = 0,
   NAVIER_STOKES       = 1
@@ -389,7 +405,7 @@ T getMax(vector<T> &vec)
 template<typename T>
 T getMin(vector<T> &vec)
 {
-  T min = 1e15;
+  T min = std::numeric_limits<T>::max();
   for (auto& i:vec) {
     if (i<min) min = i;
   }
@@ -489,7 +505,9 @@ public:
 };
 
 #ifdef _OMP
-void omp_blocked_dgemm(CBLAS_ORDER mode, CBLAS_TRANSPOSE transA,
-    CBLAS_TRANSPOSE transB, int M, int N, int K, double alpha, double* A, int lda,
-    double* B, int ldb, double beta, double* C, int ldc);
+//! Multi-threaded GEMM [double or float]: splits B & C into one block of columns per thread
+template<typename T>
+void omp_blocked_gemm(CBLAS_ORDER mode, CBLAS_TRANSPOSE transA,
+    CBLAS_TRANSPOSE transB, int M, int N, int K, double alpha, T* A, int lda,
+    T* B, int ldb, double beta, T* C, int ldc);
 #endif
@@ -86,6 +86,16 @@ private:
 
 };
 
+/*! Region of interest written to its own ParaView files at its own frequency
+ *  and plot-point resolution [see writeRegions] */
+struct plotRegion
+{
+  double xmin, xmax, ymin, ymax, zmin, zmax;  //! Bounding box; elements overlapping it are written [default: unbounded]
+  double wallDist;  //! Max. distance of an element from the nearest wall boundary [default: -1 = no limit]
+  int freq;         //! Plot frequency for this region [default: plotFreq]
+  int res;          //! Plot points per element edge [2 - order+3; default: 0 = all]
+};
+
 class input
 {
 public:
@@ -138,7 +148,7 @@ public:
   int initIter;
   int restartIter;
   int restart;
-  int restart_freq;
+  int restart_freq;  //! Frequency to write .vtu restart data [plotType 2 only; plotFreq otherwise]
   int nRKSteps;
   vector<double> RKa, RKb;
 
@@ -150,6 +160,11 @@ public:
   int n_h_levels;  //! Number of h-levels to cycle [default: 1]
   int shapeOrder; //! Shape-function order to use on generated fine grids
 
+  /* --- Performance-Tuning Options --- */
+  int autotune;         //! Time the available operator backends at startup and use the fastest [default: off/0]
+  string autotuneFile;  //! Cache file for autotuned backend choices, keyed by host & operator shape
+  int residualTasks;    //! Compute the residual as a task graph in one OpenMP parallel region [default: off/0]
+
   int iter;
 
   /* --- Moving-Grid Parameters --- */
@@ -165,9 +180,19 @@ public:
   int errorNorm;
   int quadOrder;
   int plotFreq;
-  int plotType;
+  int plotType;      //! 0: CSV, 1: ParaView .vtu, 2: Legendre modal coefficients [see tools/modal2vtu.cpp]
+  int modalOrder;    //! Max. total degree of the modes kept in modal output [default: -1 = all]
+  double modalTol;   //! Drop the highest modes holding at most this fraction of an element's non-mean energy [default: 0]
   int plotSurfaces;
   int plotPolarCoords;
+  int asyncOutput;   //! Write plot files from a background I/O thread [default: on/1]
+  int nPlotFiles;    //! # of .vtu files to aggregate all ranks' plot data into [MPI; default: 0 = one per rank]
+  string probeFile;  //! File of point-probe locations [x y (z) per line; default: none]
+  int probeFreq;     //! Frequency to sample the probes [default: every iteration; 0: never]
+  int calcStats;       //! Accumulate running mean & (co)variance of the primitives [default: off/0]
+  int statsStartIter;  //! Iteration after which to start accumulating statistics [default: 0]
+  int statsFreq;       //! Frequency to sample the running statistics [default: every iteration]
+  vector<plotRegion> plotRegions;  //! Additional region-of-interest / reduced-resolution outputs [plotType 1]
 
   bool calcEntropySensor;
 
@@ -220,13 +245,18 @@ public:
 
   /* --- Mesh Parameters --- */
   string meshFileName;          //! Gmsh file name for standard run
+  int meshCache;                //! Save/re-use the pre-processed mesh [connectivity, partitioning] in a cache file
   vector<string> oversetGrids;  //! Gmsh file names of all overset grids being used
   int meshType;     //! Type of mesh being used: Single Gmsh, create a mesh, or read multiple overset grids
+  int partitionType; //! Mesh partitioner for MPI runs: 0: METIS, 1: Recursive coordinate bisection, 2: Hilbert curve
   int nx, ny, nz;   //! For creating a structured mesh: Number of cells in each direction
   int nGrids;       //! # of grids in overset calculation
   int writeIBLANK;  //! Write IBLANK in ParaView output?
   int oversetMethod;   //! Interp. dis. sol'n (0) or corr. flux (1) at overset bounds, or use Galerkin proj. (2) on fringe cells
   int projection;   //! Use Local Galerkin Projection (1) or simple collocation (0)
+  vector<int> gridProcs;  //! # of MPI ranks for each overset grid [all 0: decide from the cost model in geo::splitGridProcs]
+  int rebalanceFreq;   //! For moving overset grids, # of iterations between load-balance checks [0: never repartition]
+  double rebalanceTol; //! Max/mean busy time within a grid above which the grid is repartitioned
   double xmin, xmax, ymin, ymax, zmin, zmax;
   double periodicTol, periodicDX, periodicDY, periodicDZ;
   string create_bcTop, create_bcBottom, create_bcLeft;
@@ -249,6 +279,7 @@ public:
   /* --- Other --- */
   int rank;
   int nproc;
+  int mpiFunneled = 1;  //! Whether MPI may be called from the master thread inside an OpenMP parallel region
 
 private:
   fileReader opts;
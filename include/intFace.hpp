@@ -75,4 +75,5 @@ private:
   Array<double*,2> dUcR;    //! Common solution for left ele (in ele's memory)  [nFpts, nFields]
   matrix<double> normR;   //! Unit outward normal at flux points  [nFpts, nDims]
   vector<double> dAR;     //! Local face-area equivalent at flux points
+  double* waveSpFaceR;    //! Wave speed integrated over the face (in right ele's memory)
 };
@@ -0,0 +1,164 @@
+/*!
+ * \file kernels.hpp
+ * \brief Header file for the operator-application kernels & autotuner
+ *
+ * Each FR operator (m x k) is applied to a global solution array of
+ * row-major layout [pt, ele, field] as C = A*B + beta*C.  Several backends
+ * are available; the fastest for each operator and partition size can be
+ * chosen at startup by timing them on the actual solver arrays.
+ *
+ * \author - Jacob Crabill
+ *           Aerospace Computing Laboratory (ACL)
+ *           Aero/Astro Department. Stanford University
+ *
+ * \version 1.0.0
+ *
+ * Flux Reconstruction in C++ (Flurry++) Code
+ * Copyright (C) 2015 Jacob Crabill
+ *
+ * Flurry++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Flurry++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with Flurry++; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "global.hpp"
+#include "input.hpp"
+
+//! Largest number of columns (fields) for which fixed-size element kernels are built
+#define MAX_SMALL_N 5
+
+/*! Enumeration for the available operator-application backends */
+enum OPP_BACKEND {
+  OPP_BLAS     = 0,  //! Single cblas_dgemm call over all elements
+  OPP_BLAS_OMP = 1,  //! omp_blocked_gemm (columns split across threads) [_OMP only]
+  OPP_SPARSE   = 2   //! Compressed-row operator (exploits tensor-product sparsity)
+};
+
+/* ---- Fixed-size kernels for per-element operator application ---- */
+
+//! Fixed-size kernel computing C [m x n] = A [m x k] * B [k x n]
+typedef void (*smallGemmFn)(const double* A, const double* B, double* C);
+
+/*!
+ * \brief Small-matrix product with all dimensions known at compile time
+ *
+ * Each row of C is accumulated in N registers while streaming through the
+ * row of A, and all loop bounds are constants, so the compiler can fully
+ * unroll the kernel.  Instantiated in kernels.cpp for the operator shapes
+ * of quads & hexes up to a fixed order.
+ */
+template<int M, int K, int N>
+void smallGemm(const double* __restrict__ A, const double* __restrict__ B, double* __restrict__ C)
+{
+  for (int i = 0; i < M; i++) {
+    double c[N];
+    for (int j = 0; j < N; j++)
+      c[j] = 0.;
+
+    for (int p = 0; p < K; p++) {
+      double a = A[i*K+p];
+      for (int j = 0; j < N; j++)
+        c[j] += a * B[p*N+j];
+    }
+
+    for (int j = 0; j < N; j++)
+      C[i*N+j] = c[j];
+  }
+}
+
+//! Get the fixed-size kernel for the given shape [NULL if not instantiated]
+smallGemmFn getSmallGemm(int m, int k, int n);
+
+//! Generic fallback for shapes without a fixed-size kernel: C = A*B
+void smallGemmGeneric(int m, int k, int n, const double* A, const double* B, double* C);
+
+class oppKernel
+{
+public:
+  //! Store a copy of the operator and build its alternate representations
+  void setup(const matrix<double> &_A, const string &_name);
+
+  //! Apply the operator to B [k x n] using the selected backend: C = A*B + beta*C
+  void apply(int n, double *B, double *C, double beta = 0.0);
+
+  //! Apply the operator using a specific backend
+  void apply(int n, double *B, double *C, double beta, int _backend);
+
+  //! Single-precision versions of the above [uses cblas_sgemm]
+  void apply(int n, float *B, float *C, double beta = 0.0);
+  void apply(int n, float *B, float *C, double beta, int _backend);
+
+  /*! Apply the operator serially to a block of n columns of B & C, which have
+   *  leading dimension ld [e.g. a block of elements, from within a task] */
+  void applyCols(int n, int ld, double *B, double *C, double beta);
+  void applyCols(int n, int ld, float *B, float *C, double beta);
+
+  //! Apply the operator to one element's data B [k x n] using a fixed-size kernel: C = A*B
+  void applyEle(int n, const double *B, double *C);
+
+  string name;      //! Operator name [used as part of the autotuner key]
+  int m = 0, k = 0; //! Operator dimensions
+  int backend = OPP_BLAS;
+
+private:
+  matrix<double> A;
+  vector<float> Af;  //! Single-precision copy of A
+
+  /* Compressed-row storage of A for OPP_SPARSE */
+  vector<int> rowPtr, colInd;
+  vector<double> vals;
+  vector<float> valsf;
+
+  //! Fixed-size element kernels for n = 1..MAX_SMALL_N
+  smallGemmFn eleFns[MAX_SMALL_N+1] = {};
+
+  template<typename T>
+  void applySparse(int n, int ld, const T *vals, T *B, T *C, double beta);
+};
+
+class oppTuner
+{
+public:
+  //! Read in any previously-cached backend choices
+  void setup(input *_params);
+
+  /*!
+   * \brief Select the fastest backend for the given kernel
+   *
+   * Uses the cached choice for this (host, threads, operator, m, n, k) if one
+   * exists; otherwise, times each candidate on scratch arrays of type T
+   * [double or float]. Collective: all ranks get the same backend.
+   */
+  template<typename T>
+  void tune(oppKernel &kern, int n, double beta);
+
+  //! Append all newly-timed choices to the cache file [rank 0]
+  void writeCache(void);
+
+private:
+  input *params;
+
+  string hostName;
+  int nThreads;
+
+  map<string,int> cache;      //! All known backend choices
+  vector<string> newEntries;  //! Cache-file lines for choices timed during this run
+
+  string getKey(const oppKernel &kern, int n, bool single);
+};
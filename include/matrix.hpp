@@ -235,6 +235,7 @@ public:
 
   /* --- Search Operations --- */
 
-  /*! Find all unique 'rows' in a Array */
+  /*! Find all unique 'rows' in a Array [numbered in order of first occurence;
+   *  iRow gives the unique row matching each row] */
   void unique(matrix<T> &out, vector<int> &iRow);
 };
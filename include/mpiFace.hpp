@@ -79,6 +79,8 @@ public:
   //! Send the right-state gradient data across the processor boundary using MPI
   void communicateGrad();
 
+  double waitTime = 0;     //! Wall time spent in MPI_Wait for the right-state data [s]
+
   int procL;               //! Processor ID on left  [this face]
   int procR;               //! Processor ID on right [opposite face]
   int IDR;                 //! Local face ID of face on right processor
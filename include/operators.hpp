@@ -36,9 +36,13 @@
 #include "funcs.hpp"
 #include "geo.hpp"
 #include "input.hpp"
+#include "kernels.hpp"
 #include "matrix.hpp"
 #include "points.hpp"
 
+//! Maximum number of solution points in each direction of a tensor-product element
+#define MAX_PTS_1D 12
+
 class oper
 {
 public:
@@ -56,6 +60,9 @@ public:
 
   void setupInterpolateSptsQpts(int quadOrder);
 
+  //! Setup the transform from values at the spts to hierarchical Legendre modal coefficients
+  void setupSptsModes(void);
+
   //! Setup operator for calculation of gradient at the solution points
   void setupGradSpts(void);
 
@@ -131,6 +138,7 @@ public:
 
   matrix<double> opp_prolong;   //! PMG Prolongation operator
   matrix<double> opp_restrict;  //! PMG Restriction operator
+  oppKernel kern_restrict;      //! PMG Restriction [applied to both U_spts and divF_spts]
 
   geo *Geo;
   input *params;
@@ -143,6 +151,9 @@ public:
   matrix<double> opp_spts_to_mpts;
   matrix<double> opp_spts_to_ppts;
   matrix<double> opp_spts_to_qpts;
+  matrix<double> opp_spts_to_modes;  //! Inverse of the tensor-product Legendre Vandermonde matrix [mode, spt]
+  vector<double> modeNorm;           //! Squared L2 norm of each mode over the reference element
+  vector<int> modeDegree;            //! Total degree of each mode [modes are sorted by degree]
   vector<matrix<double>> opp_grad_spts;
   vector<matrix<double>> gradCpts_cpts, gradCpts_spts, gradCpts_fpts; //! Consistent grid points
   matrix<double> opp_div_spts;
@@ -151,12 +162,24 @@ public:
   vector<matrix<double>> opp_correctU;
   vector<matrix<double>> opp_correctF;
 
+  //! Fixed-size kernels for applying operators to a single element's data
+  oppKernel kern_spts_to_fpts, kern_spts_to_mpts;
+  vector<oppKernel> kern_grad_spts;
+
 private:
   //! Flux at solution points to normal flux at fpts [Reference space]
   void setupExtrapolateFn(void);
 
   matrix<double> tempFn;
 
+  vector<double> loc_spts_1D;  //! 1D solution-point locations [tensor-product elements]
+
+  //! Fixed-size kernels for single-point interpolation, for n = 1..MAX_SMALL_N fields
+  smallGemmFn interpFns[MAX_SMALL_N+1] = {};
+
+  //! Setup the fixed-size kernels used by the per-element apply* functions
+  void setupEleKernels(void);
+
   void setupCorrectF(void);
 
   //! Evalulate the VCJH correction function at a solution point from a flux point */
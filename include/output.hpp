@@ -28,19 +28,110 @@
  */
 #pragma once
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 #include "global.hpp"
 #include "solver.hpp"
 #include "ele.hpp"
 #include "geo.hpp"
 
+/*! Snapshot of everything needed to write one ParaView or modal plot file, so
+ *  that the file can be formatted & written while the solver continues to advance */
+struct plotData
+{
+  input *params;
+  int plotType = 1;  //! Kind of file to write [1: ParaView .vtu, 2: modal]
+  int iter;
+  double time;
+  int nPpts1D;  //! Plot points per element edge [fewer than order+3 for reduced-resolution regions]
+  int nPpts;    //! Plot points per element
+
+  string vtuFile;             //! This rank's .vtu file [empty if no elements to write]
+  string dataDir;             //! Sub-directory holding the .vtu files [MPI only]
+  string pvtuFile;            //! 'Master' .pvtu file [empty if not written by this rank]
+  vector<string> pvtuPieces;  //! .vtu files listed in the .pvtu file
+  vector<int> rankPieces;     //! [rank, # of pieces] for each rank gathered into this file [nPlotFiles > 0]
+  string epartFile;           //! File for the grid's partition, to restart a rebalanced run on [empty if not written by this rank]
+  vector<int> epart;          //! Partition of the grid [rank of each global cell]
+
+  vector<int> eles;           //! Index of each element to write in the arrays below
+  vector<int> iblankEle;      //! IBLANK value of each element to write
+  vector<double> sensor;      //! Shock-capturing sensor of each element to write
+  vector<int> iblankCell;     //! Cell IBLANK data for the file header [overset]
+  vector<matrix<double>> errPpts;  //! Entropy-error estimate of each element to write
+
+  Array<double,3> V_ppts, pos_ppts, gridV_ppts;  //! Primitives, positions, & grid velocity at ppts
+  Array<double,3> stats_ppts;  //! Running statistics at ppts [params->calcStats]
+
+  string modalFile;           //! This rank's .modal file [plotType 2]
+  int order, nSpts;           //! Polynomial order & # of spts of the modal data
+  vector<double> pts1D;       //! 1D plot-point locations for the modal file header
+  vector<int> nModes;         //! # of modes kept for each element to write
+  vector<double> modes;       //! pos_modes & kept U_modes of each element, back to back
+};
+
+/*! Dedicated I/O thread which writes plotData snapshots in the background.
+ *  Two buffers are used: the solver fills one while the other is being written. */
+class plotWriter
+{
+public:
+  ~plotWriter(void);
+
+  //! Get the buffer to fill with the next snapshot [never the one being written]
+  plotData& getBuffer(void);
+
+  //! Hand the filled buffer to the I/O thread [waits only if the previous file is still being written]
+  void submit(void);
+
+  //! Wait for the file currently being written [if any] to be finished
+  void finish(void);
+
+private:
+  plotData buffers[2];
+  int fillBuf = 0;     //! Buffer currently being filled by the solver
+  int writeBuf = 0;    //! Buffer currently being written by the I/O thread
+  bool busy = false;   //! Whether the I/O thread is writing a buffer
+  bool stop = false;   //! Signal for the I/O thread to exit
+
+  std::thread ioThread;
+  std::mutex mtx;
+  std::condition_variable cv;
+
+  //! Main loop of the I/O thread
+  void run(void);
+};
+
 /*! Write solution to file (of type params->plotType) */
 void writeData(solver *Solver, input *params);
 
+/*! Wait for any plot files still being written in the background */
+void finishWriteData(void);
+
+/*! Write the running statistics at the solution points, for restarting. */
+void writeStats(solver *Solver, input *params);
+
+/*! Write the Legendre modal coefficients of the solution to a compact binary file
+ *  [optionally truncated by params->modalOrder / params->modalTol; in the background
+ *  if params->asyncOutput]. */
+void writeModal(solver *Solver, input *params);
+
 /*! Write solution data to a CSV file. */
 void writeCSV(solver *Solver, input *params);
 
-/*! Write solution data to a Paraview .vtu file. */
-void writeParaview(solver *Solver, input *params);
+/*! Write solution data to a Paraview .vtu file [in the background if params->asyncOutput].
+ *  If region >= 0, only write the elements in params->plotRegions[region] at its resolution. */
+void writeParaview(solver *Solver, input *params, int region = -1);
+
+/*! Write the plot regions which are due at this iteration to their own .vtu files. */
+void writeRegions(solver *Solver, input *params);
+
+/*! Write a snapshot of the solution data to the Paraview .pvtu/.vtu files. */
+void writeParaviewData(plotData &data);
+
+/*! Write a snapshot of the modal coefficients to a binary .modal file. */
+void writeModalData(plotData &data);
 
 /*! Write out surface data to a Paraview .vtu file. */
 void writeSurfaces(solver *Solver, input *params);
@@ -48,11 +139,18 @@ void writeSurfaces(solver *Solver, input *params);
 /*! Compute the residual and print to both the terminal and history file. */
 void writeResidual(solver *Solver, input *params);
 
+/*! Sample the point probes and append them to the binary probe time-series file. */
+void writeProbes(solver *Solver, input *params);
+
 /*! Compute and display all error norms */
 void writeAllError(solver *Solver, input *params);
 
 /*! Compute the conservation, L1, or L2 solution error (for certain test cases) and print to screen. */
 void writeError(solver *Solver, input *params);
 
+/*! For overset runs, report the measured work on each grid & the split of MPI ranks it suggests [gridProcs]
+ *  for a fresh run; restart files can only be read back on the partition that wrote them */
+void writeGridBalance(solver *Solver, input *params);
+
 /*! Write a Tecplot mesh file compatible with TIOGA's testTioga FORTRAN interface */
 void writeMeshTecplot(geo *Geo, input* params);
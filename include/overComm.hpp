@@ -34,6 +34,7 @@
 
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -62,6 +63,9 @@ class overComm
 public:
   overComm();
 
+  //! Free the persistent requests & communicators [if MPI is still running]
+  ~overComm();
+
   int nDims;
   int nGrids;
   int nprocPerGrid;
@@ -77,7 +81,9 @@ public:
   input *params;  //! Simulation input parameters
 
 #ifndef _NO_MPI
-  MPI_Comm gridComm;
+  MPI_Comm gridComm = MPI_COMM_NULL;
+  MPI_Comm interComm = MPI_COMM_NULL;  //! Duplicate of MPI_COMM_WORLD for the overset-point data exchange
+  MPI_Comm gradComm = MPI_COMM_NULL;   //! Separate duplicate for the gradient exchange [so tags needn't differ]
 
   shared_ptr<tioga> tg;  //! TIOGA object in use for simulation
   shared_ptr<ADT> adt;   //! Alternating Digital Tree for searching
@@ -85,7 +91,6 @@ public:
 
   /* --- Variables for Exchanging Data at Overset Faces --- */
 
-  vector<int> nPts_rank;           //! Number of fringe points for each rank of current grid
   vector<vector<int>> foundPts;    //! IDs of receptor points from each grid which were found to lie within current grid
   vector<vector<int>> foundRank;   //! gridRank of this process for each found point (for benefit of other processes; probably not needed)
   vector<vector<int>> foundEles;   //! Ele ID which each matched point was found to lie within
@@ -108,6 +113,8 @@ public:
   matrix<double> gradU_in;          //! Gradient data received from other grid(s)
   vector<matrix<double>> gradU_out; //! Interpolated gradient data being sent to other grid(s)
 
+  double waitTime = 0;  //! Wall time spent waiting on the data from other grid(s) [s]
+
   /* --- Variables for Exchanging Data on Unblanked Cells --- */
 
   vector<int> nCells_rank;              //! Number of unblanked cells for each rank of current grid
@@ -140,10 +147,13 @@ public:
   /*!
    * \brief Match up each overset-face flux point to its donor grid and element
    *
-   * @param[in] c2ac    : List (for each cell in grid partition) of all cells which share at least one vertex
+   * Fringe points are only sent to the ranks of other grids whose partition
+   * bounding box contains them, rather than gathered onto every rank
+   *
+   * @param[in] eles    : Elements on this grid partition
    * @param[in] eleMap  : 'Map' from the grid-global cell ID to its index within 'eles' vector (or -1 if blanked cell)
-   * @param[in] centroid: Centriod of current grid partition
-   * @param[in] extents : x,y,z extents (max-min) of current grid partition
+   * @param[in] minPt   : Minimum x,y,z corner of current grid partition's bounding box
+   * @param[in] maxPt   : Maximum x,y,z corner of current grid partition's bounding box
    */
   void matchOversetPoints(vector<shared_ptr<ele>> &eles, const vector<int> &eleMap, const point &minPt = point({0,0,0}), const point &maxPt = point({0,0,0}));
 
@@ -165,12 +175,41 @@ public:
   //! Integrate the solution error over the entire domain, accounting for overset overlap
   vector<double> integrateErrOverset(vector<shared_ptr<ele> >& eles, map<int, oper>& opers, vector<int>& iblankCell, vector<int>& eleMap, int order, int quadOrder);
 
+  /*!
+   * \brief Compile the donor interpolation into a sparse weight matrix for each destination rank
+   *
+   * For static grids, the donor cells & reference locations never change, so the
+   * interpolation to every found point is a fixed linear combination of U_spts
+   */
+  void setupInterpMatrix(vector<shared_ptr<ele>> &eles, map<int, oper>& opers, vector<int> &eleMap);
+
+  /*!
+   * \brief Setup the persistent point-data exchange for the current set of matched points
+   *
+   * Exchanges the matched-point counts & IDs with all other grids, sizes the
+   * send/receive buffers, and creates the persistent MPI requests used by
+   * sendOversetData / sendOversetGradient
+   */
+  void setupOversetComm(void);
+
   //! Perform the interpolation and communicate data across all grids
   void exchangeOversetData(vector<shared_ptr<ele>> &eles, map<int, oper>& opers, vector<int> &eleMap);
 
+  //! Perform the interpolation to the matched points and start sending the data to the other grids
+  void sendOversetData(vector<shared_ptr<ele>> &eles, map<int, oper>& opers, vector<int> &eleMap);
+
+  //! Wait for the data started by sendOversetData & copy it into U_in
+  void recvOversetData(void);
+
   //! Perform the interpolation and communicate gradient across all grids
   void exchangeOversetGradient(vector<shared_ptr<ele>> &eles, map<int, oper>& opers, vector<int> &eleMap);
 
+  //! Perform the gradient interpolation to the matched points and start sending it to the other grids
+  void sendOversetGradient(vector<shared_ptr<ele>> &eles, map<int, oper>& opers, vector<int> &eleMap);
+
+  //! Wait for the gradient started by sendOversetGradient & copy it into gradU_in
+  void recvOversetGradient(void);
+
   /*!
    * \brief Gather a distributed dataset so that every rank has the full, organized dataset
    *
@@ -197,7 +236,7 @@ public:
    * @param[in] matchInds   : Whether each rank needs to receive recvInds for its data or not
    */
   template<typename T>
-  void sendRecvData(vector<int> &nPiecesSend, vector<int> &nPiecesRecv, vector<vector<int>> &sendInds, vector<vector<int>> &recvInds, vector<matrix<T>> &sendVals, matrix<T> &recvVals, int stride, bool matchInds);
+  void sendRecvData(vector<int> &nPiecesSend, vector<int> &nPiecesRecv, vector<vector<int>> &sendInds, vector<vector<int>> &recvInds, vector<matrix<T>> &sendVals, matrix<T> &recvVals, int stride, bool matchInds = false);
 
   template<typename T>
   void sendRecvData(vector<int> &nPiecesSend, vector<int> &nPiecesRecv, vector<vector<int>> &sendInds, vector<vector<int>> &recvInds, vector<matrix<T>> &sendVals, vector<matrix<T>> &recvVals, int stride);
@@ -219,11 +258,46 @@ public:
 
 private:
 
+  /*!
+   * \brief Search for a point's donor starting from its donor at the previous match [for moving grids]
+   *
+   * Tests the previous donor cell, using the previous reference location as the
+   * Newton initial guess, and then its face neighbours
+   *
+   * @param[in] ic0     : Previous donor cell [grid-local ID]
+   * @param[in/out] loc : Previous reference location in; new reference location out
+   * @return Grid-local ID of the donor cell, or -1 if not found nearby
+   */
+  int findDonorNear(vector<shared_ptr<ele>> &eles, const vector<int> &eleMap, int ic0, const point &pt, point &loc);
+
   /* ---- For Static Cases using Field Interpolation ---- */
-  vector<matrix<double>> qpts, qptsD_ref, donorBasis, massMatTDRow, ubLHS;
+  vector<matrix<double>> qpts, qptsD_ref, donorBasis, massMatTDRow;
+  vector<matrix<double>> ubLHS;  //! Cholesky factor of the mass matrix of each unblanked cell
+
+  //! Cached [mass matrix, Cholesky factor] by ele ID, for fully-covered cells on grids which can't deform
+  map<int,std::pair<matrix<double>,matrix<double>>> massFactors;
+
+  //! Solve for & apply the projected solution to each unblanked cell, given the projected RHS
+  void applyProjection(vector<shared_ptr<ele>> &eles, vector<matrix<double>> &ubRHS);
   vector<vector<int>> targetID, donorID;
   vector<vector<int>> recvInds;
 
+  /* ---- For Static Cases using Solution Interpolation ---- */
+  //! Donor-interpolation weights [CSR] for each destination rank: point i uses entries
+  //! interpPtr[p][i] to interpPtr[p][i+1] of interpInd [offset of U_spts(spt,0) from the start of the solver's U_spts] & interpWts
+  vector<vector<int>> interpPtr;
+  vector<vector<size_t>> interpInd;
+  vector<vector<double>> interpWts;
+  bool haveInterpMatrix = false;
+
+  /* ---- Persistent Point-Data Exchange [see setupOversetComm] ---- */
+  vector<matrix<double>> U_recv, gradU_recv;  //! Receive buffers for the data from each rank
+#ifndef _NO_MPI
+  vector<MPI_Request> U_requests, gradU_requests;
+#endif
+  bool dataPending = false;  //! Whether a sendOversetData is awaiting its recvOversetData
+  bool gradPending = false;  //! Whether a sendOversetGradient is awaiting its recvOversetGradient
+
   //! For use with ADT in 2D
   vector<int> eleList;
 };
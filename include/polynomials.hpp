@@ -47,6 +47,10 @@ double dLegendre(double in_r, int in_mode);
 /*! Evaluate the 2D Legendre polynomial mode number in_mode based at point location in_r*/
 double Legendre2D_hierarchical(int in_mode, vector<double> in_loc, int in_basis_order);
 
+/*! Get the 1D Legendre mode [i,j,k] in each direction of each tensor-product mode,
+ *  sorted hierarchically by total degree i+j+k [k = 0 in 2D] */
+vector<array<int,3>> getModeIndices(int nDims, int order);
+
 /*! Method to calculate co-efficients of the exponential filter */
 double exponential_filter(int in_mode, int inBasisOrder, double exponent);
 
@@ -28,6 +28,7 @@
  */
 #pragma once
 
+#include <array>
 #include <memory>
 #include <map>
 #include <set>
@@ -41,6 +42,7 @@ class overFace;
 #include "ele.hpp"
 #include "geo.hpp"
 #include "input.hpp"
+#include "kernels.hpp"
 #include "face.hpp"
 #include "intFace.hpp"
 #include "boundFace.hpp"
@@ -68,6 +70,11 @@ public:
   //! Map from eType to order to element- & order-specific operator
   map<int, oper> opers;
 
+  //! Kernels used to apply the baseline-order operators to the global solution arrays
+  oppKernel kern_spts_to_fpts, kern_spts_to_mpts, kern_spts_to_ppts, kern_correction;
+  oppKernel kern_spts_to_modes;  //! Nodal to modal transform [modal output only]
+  vector<oppKernel> kern_grad_spts, kern_extrapolateFn, kern_correctU;
+
   //! Vector of all eles handled by this solver
   vector<shared_ptr<ele>> eles;
 
@@ -93,13 +100,17 @@ public:
   /* Solution Variables */
   Array<double,3> U0, U_spts, U_fpts, U_mpts, V_ppts, U_qpts; //! Global solution arrays for solver
   Array<double,3> V_spts; //! Primitives at solution points
-  Array<double,4> F_spts, F_fpts, dU_spts, dU_fpts;   //! dim, spt/fpt, ele, field?
-  Array<double,3> disFn_fpts, Fn_fpts, dUc_fpts;  //! fpt, ele, field
-  Array2D<Array<double,3>> dF_spts; //! dim_grad, dim_flux, spt, ele, field
+  Array<double,4> F_fpts, dU_spts, dU_fpts;   //! dim, spt/fpt, ele, field?
+  Array<double,3> Fn_fpts, dUc_fpts;  //! fpt, ele, field
 
-  vector<Array<double,3>> divF_spts;
+  /* Flux Variables [see flux_t in global.hpp] */
+  Array<flux_t,4> F_spts;                 //! dim, spt, ele, field
+  Array<flux_t,3> disFn_fpts;             //! fpt, ele, field
+  Array2D<Array<flux_t,3>> dF_spts;       //! dim_grad, dim_flux, spt, ele, field
+  vector<Array<flux_t,3>> divF_spts;
 
-  Array<double,3> tempVars_fpts, tempVars_spts;  //! Temporary/intermediate solution storage array
+  Array<double,3> tempVars_spts;  //! Temporary/intermediate solution storage array
+  Array<flux_t,3> tempVars_fpts;  //! Temporary/intermediate flux storage array
   double tempF[3][5];                            //! Temporary flux-storage array
   matrix<double> tempDU;
 
@@ -109,6 +120,8 @@ public:
   /* Geometry Variables */
 
   Array2D<double> detJac_spts, detJac_fpts, detJac_qpts, dA_fpts, tNorm_fpts;
+  vector<double> vol_eles;         //! Volume of each element [for CFL-based dt]
+  Array2D<double> waveSp_faces;    //! Wave speed integrated over each face of each ele [ele, face]; set by face flux kernels
   matrix<double> shape_spts, shape_fpts, shape_ppts;
   Array<double,3> dshape_spts, dshape_fpts;
   Array<double,3> gridV_spts, gridV_fpts, gridV_mpts, gridV_ppts;
@@ -120,6 +133,28 @@ public:
   Array<double,3> nodes, nodesRK; //! nNodes, nEles, nDims
   Array<double,3> pos_spts, pos_fpts, pos_ppts;  //! nSpts/NFpts, nEles, nDims
 
+  /* Point-Probe Variables */
+  vector<point> probePts;   //! Location of every probe [same on all ranks]
+  vector<int> probeOwner;   //! Rank holding each probe [nproc if not found in the mesh]
+  vector<int> probeIDs;     //! Index into probePts of each probe held on this rank
+  vector<int> probeEles;    //! Donor element [index into eles] of each probe held on this rank
+  vector<int> probeIDg;     //! Global ID of the donor element of each probe held on this rank
+  matrix<double> probeWts;  //! Interpolation weights from the donor's spts [probe, spt]
+  matrix<double> probeV;    //! Primitive variables at each probe held on this rank [probe, field]
+
+  /* Plot-Region Variables */
+  vector<double> eleWallDist;  //! Approx. distance of each element from the nearest wall [INFINITY if beyond all plot regions' wallDist]
+
+  /* Modal-Output Variables */
+  Array<double,3> U_modes, pos_modes;  //! Legendre modal coefficients of U_spts & pos_spts [mode, ele, field/dim]
+
+  /* Running-Statistics Variables */
+  uint nStats;                 //! nFields means, nFields variances, & the velocity cross-covariances [uv, uw, vw]
+  Array<double,3> stats_spts;  //! Running mean & co-moment sums of the primitives [spt, ele, stat]
+  Array<double,3> stats_ppts;  //! Mean & (co)variance of the primitives at the plot points [ppt, ele, stat]
+  double statsTime = 0;        //! Total flow time [weight] accumulated in stats_spts
+  double statsLastTime = 0;    //! Flow time of the last sample
+
 
   /* CSC Metric Variables */
   int nCpts;
@@ -137,6 +172,10 @@ public:
 
   int order;  //! Baseline solution order
 
+  double updateTime = 0;  //! Total wall time spent in update() [s]
+  double waitTime = 0;    //! Wall time spent waiting on the global time-step reduction [s]
+  double mpiWaitTime = 0; //! Wall time spent waiting on the MPI-face data from the rest of this grid [s; collected in rebalance]
+
   /* === Setup Functions === */
 
   solver();
@@ -149,6 +188,9 @@ public:
   //! Setup the FR operators for all ele types and polynomial orders which will be used in computation
   void setupOperators();
 
+  //! Setup the operator-application kernels, autotuning their backends if requested
+  void setupKernels();
+
   //! Run the basic setup functions for all elements and faces
   void setupElesFaces();
 
@@ -174,9 +216,17 @@ public:
   //! Perform one full step of computation
   void calcResidual(int step);
 
+  /*! Perform one full step of computation as a graph of OpenMP tasks over
+   *  element blocks & face chunks, all within a single parallel region */
+  void calcResidual_tasks(int step);
+
   //! Calculate the stable time step limit based upon given CFL
   void calcDt(void);
 
+  /*! Compute the CFL-based time step from the wave speeds integrated by the
+   *  face flux kernels, and begin its global reduction [finished by calcDt] */
+  void calcDt_faces(void);
+
   /*! Advance solution in time - Generate intermediate RK stage
    * \param PMG_source: If true, add PMG source term
    */
@@ -272,6 +322,21 @@ public:
   //! Apply mesh motion
   void moveMesh(int step);
 
+  /* --- Element-block [eStart, eEnd) & face-chunk [fStart, fEnd) versions of
+   * the above, for use as tasks within calcResidual_tasks --- */
+
+  void extrapolateU(uint eStart, uint eEnd);
+  void calcGradU_spts(uint eStart, uint eEnd);
+  void calcInviscidFlux_spts(uint eStart, uint eEnd);
+  void calcInviscidFlux_faces(uint fStart, uint fEnd);
+  void correctGradU(uint eStart, uint eEnd);
+  void extrapolateGradU(uint eStart, uint eEnd);
+  void calcViscousFlux_spts(uint eStart, uint eEnd);
+  void calcViscousFlux_faces(uint fStart, uint fEnd);
+  void extrapolateNormalFlux(uint eStart, uint eEnd);
+  void calcDivF_spts(int step, uint eStart, uint eEnd);
+  void correctDivFlux(int step, uint eStart, uint eEnd);
+
   //! Integrate forces on all wall-type boundaries
   vector<double> computeWallForce(void);
 
@@ -281,6 +346,36 @@ public:
   //! For implemented test cases, calculate the L1 error over the domain
   vector<double> integrateError(void);
 
+  /* === Functions for Point Probes === */
+
+  //! Read the probe locations [params->probeFile] and locate them in the mesh
+  void setupProbes(void);
+
+  //! Find the donor element & interpolation weights of each probe on this rank
+  void locateProbes(void);
+
+  //! Interpolate the primitive variables to each probe on this rank [probeV]
+  void calcProbeData(void);
+
+  //! Get the modal coefficients of the solution & geometry [U_modes, pos_modes]
+  void calcModes(void);
+
+  /* === Functions for Plot Regions === */
+
+  //! Get each element's distance from the nearest wall boundary, out to the largest plot-region wallDist [eleWallDist]
+  void calcWallDistance(void);
+
+  /* === Functions for Running Statistics === */
+
+  //! Add the current primitives at the spts to the running statistics, weighted by elapsed flow time
+  void accumulateStats(void);
+
+  //! Get the mean & (co)variance of the primitives at the plot points [stats_ppts]
+  void extrapolateStatsPpts(void);
+
+  //! Read the running statistics saved alongside the restart file
+  void readStatsFile(void);
+
   /* === Functions for Shock Capturing & Filtering=== */
 
   //! Use concentration sensor + exponential modal filter to capture discontinuities
@@ -296,6 +391,13 @@ public:
   //! Do initial preprocessing for overset grids
   void setupOverset();
 
+  /*! For moving overset grids, re-cut any grid whose ranks have drifted out of
+   *  balance as cells are blanked & unblanked, migrating the solution */
+  void rebalance(void);
+
+  //! Fill the newly-unblanked cells [Geo->unblankCells] from the other grids
+  void projectUnblankCells(void);
+
   //! For moving grids, update the overset connectivity (including adding/removing cells/faces)
   void updateOversetConnectivity(bool doBlanking = true);
 
@@ -342,10 +444,10 @@ public:
   //! Perform Galerkin projection to fringe cells instead of boundary method
   void oversetFieldInterp();
 
-  //! Interpolate 'right state' to overset boundaries for Riemann solve
+  //! Interpolate 'right state' to overset boundaries for Riemann solve [received in calcInviscidFlux_overset]
   void oversetInterp();
 
-  //! Interpolate 'right state' gradient to overset boundaries for viscous flux
+  //! Interpolate 'right state' gradient to overset boundaries for viscous flux [received in calcViscousFlux_overset]
   void oversetInterp_gradient();
 
   /* ---- Stabilization Functions ---- */
@@ -365,6 +467,35 @@ public:
 
   void calcCSCMetrics(void);
 private:
+  /* ---- Residual Task Graph ---- */
+
+  bool useTasks = false;            //! Whether to compute the residual using calcResidual_tasks
+  vector<array<uint,2>> eleBlocks;  //! Element range [start, end) of each element block
+  vector<array<uint,2>> faceChunks; //! Range [start, end) of each chunk of faces
+  vector<vector<int>> chunkBlocks;  //! Element blocks touched by each face chunk
+  vector<vector<int>> blockChunks;  //! Face chunks touching each element block
+
+  //! Dependence tokens for each block / chunk [only their addresses are used]
+  vector<char> depU, depDU, depF, depFn;
+
+  //! Partition the elements & faces for calcResidual_tasks, if it can be used
+  void setupTaskGraph(void);
+
+  //! Transform the corrected solution gradient back to physical space
+  void transformGradU_spts(uint eStart, uint eEnd);
+
+  /* ---- Overset Load Balancing ---- */
+
+  double lastBusyTime = 0;  //! Busy time [update() less all waiting] at the last check in rebalance
+
+  /* ---- CFL-based Time Step Reduction ---- */
+
+  double dtLocal, dtGlobal;  //! Local & global minimum of the CFL-based time step
+  bool dtPending = false;    //! Whether calcDt_faces has begun a reduction not yet completed
+#ifndef _NO_MPI
+  MPI_Request dtRequest;
+#endif
+
   //! Pointer to the parameters object for the current solution
   input *params;
 
@@ -140,6 +140,13 @@ private:
 
 /* --- Extra Helper Functions --- */
 
+/*!
+ * \brief Build the supermesh [and its quadrature points] for each target cell, in parallel
+ *
+ * meshes[i] is built from targets[i] & donors[i], with ID i
+ */
+void buildSuperMeshes(vector<superMesh> &meshes, vector<vector<point>> &targets, vector<Array2D<point>> &donors, int order, int nDims, int rank);
+
 //! Subdivide the given hexahedron into 5 tetrahedrons
 vector<tetra> splitHexIntoTets(const vector<point> &hexNodes);
 
@@ -149,9 +156,15 @@ vector<triangle> splitQuadIntoTris(const vector<point> &quadNodes);
 //! Use the given face and outward normal to clip the given tet and return the new set of tets
 vector<tetra> clipTet(tetra &tet, const vector<point> &clipFace, Vec3 &norm);
 
+//! Clip the tet by the plane through xc with outward normal norm; writes up to 3 tets to outTets & returns the count
+int clipTet(const tetra &tet, point xc, Vec3 norm, tetra *outTets);
+
 //! Use the given face and outward normal to clip the given triangle and return the new set of tris
 vector<triangle> clipTri(triangle &tri, const vector<point> &clipFace, Vec3 &norm);
 
+//! Clip the triangle by the line through xc with outward normal norm; writes up to 2 tris to outTris & returns the count
+int clipTri(const triangle &tri, point xc, Vec3 norm, triangle *outTris);
+
 double getAreaTri(std::array<point,3> &nodes);
 
 double getVolumeTet(std::array<point,4> &nodes);
@@ -21,9 +21,13 @@ private :
   double *adtReals;  /** < real numbers that provide the extents of each box */
   double *adtExtents; /** < global extents */
   double *coord;          /** < bounding box of each element */
+  double offset[3];   /** < rigid translation of the elements since their bounding boxes were set */
+
+  //! Set the global extents of the tree from the element bounding boxes
+  void setExtents(void);
 
 public :
-  ADT() {ndim=6;nelem=0;adtIntegers=NULL;adtReals=NULL;adtExtents=NULL;coord=NULL;}
+  ADT() {ndim=6;nelem=0;adtIntegers=NULL;adtReals=NULL;adtExtents=NULL;coord=NULL;offset[0]=offset[1]=offset[2]=0;}
 
   ~ADT()
   {
@@ -48,6 +52,12 @@ public :
 
   void buildADT(int d,int nelements,double *elementBbox);
 
+  //! Update the node extents in place after the element bounding boxes have changed [tree structure is kept]
+  void refitADT(void);
+
+  //! Set a rigid translation of the elements, applied (inversely) to the boxes given to searchADT_box
+  void setOffset(double *dx);
+
   //! Search the ADT for the element containint the point xsearch
   void searchADT_point(MeshBlock *mb,int *cellIndex,double *xsearch);
 
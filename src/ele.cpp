@@ -105,7 +105,7 @@ double& ele::U_spts(int spt, int field)
   return Solver->U_spts(spt, sID, field);
 }
 
-double& ele::F_spts(int dim, int spt, int field)
+flux_t& ele::F_spts(int dim, int spt, int field)
 {
   return Solver->F_spts(dim, spt, sID, field);
 }
@@ -115,7 +115,7 @@ double& ele::dU_spts(int dim, int spt, int field)
   return Solver->dU_spts(dim, spt, sID, field);
 }
 
-double& ele::dF_spts(int dim_grad, int dim_flux, int spt, int field)
+flux_t& ele::dF_spts(int dim_grad, int dim_flux, int spt, int field)
 {
   return Solver->dF_spts(dim_grad, dim_flux)(spt, sID, field);
 }
@@ -135,7 +135,7 @@ double& ele::Fn_fpts(int fpt, int field)
   return Solver->Fn_fpts(fpt, sID, field);
 }
 
-double& ele::disFn_fpts(int fpt, int field)
+flux_t& ele::disFn_fpts(int fpt, int field)
 {
   return Solver->disFn_fpts(fpt, sID, field);
 }
@@ -150,7 +150,7 @@ double& ele::dUc_fpts(int fpt, int field)
   return Solver->dUc_fpts(fpt, sID, field);
 }
 
-double& ele::divF_spts(int step, int spt, int field)
+flux_t& ele::divF_spts(int step, int spt, int field)
 {
   return Solver->divF_spts[step](spt, sID, field);
 }
@@ -207,6 +207,11 @@ double& ele::dA_fpts(int fpt)
   return Solver->dA_fpts(fpt, sID);
 }
 
+double& ele::waveSp_faces(int face)
+{
+  return Solver->waveSp_faces(sID, face);
+}
+
 double& ele::Jac_spts(int spt, int dim1, int dim2)
 {
   return Solver->Jac_spts(dim2, spt, sID, dim1);
@@ -485,79 +490,121 @@ vector<double> ele::getBoundingBox(void)
   return bbox;
 }
 
-bool ele::getRefLocNewton(point pos, point &loc)
+//! Largest element [# of nodes] supported by the fixed-size Newton inversion storage
+static const int MAX_NEWTON_NODES = 216;
+
+/*! Shape functions & their ref.-space derivatives at loc [dshape: nNodes x nDims];
+ *  linear quads/hexes use closed-form expressions */
+static inline void calcShapeNewton(const point &loc, double *shape, double *dshape, int nNodes, int nDims)
+{
+  if (nDims == 2 && nNodes == 4) {
+    const double XI[4]  = {-1,1,1,-1};
+    const double ETA[4] = {-1,-1,1,1};
+    for (int n = 0; n < 4; n++) {
+      double a = 1 + loc.x*XI[n];
+      double b = 1 + loc.y*ETA[n];
+      shape[n] = .25*a*b;
+      dshape[2*n+0] = .25*XI[n]*b;
+      dshape[2*n+1] = .25*ETA[n]*a;
+    }
+  } else if (nDims == 3 && nNodes == 8) {
+    const double XI[8]  = {-1,1,1,-1,-1,1,1,-1};
+    const double ETA[8] = {-1,-1,1,1,-1,-1,1,1};
+    const double MU[8]  = {-1,-1,-1,-1,1,1,1,1};
+    for (int n = 0; n < 8; n++) {
+      double a = 1 + loc.x*XI[n];
+      double b = 1 + loc.y*ETA[n];
+      double c = 1 + loc.z*MU[n];
+      shape[n] = .125*a*b*c;
+      dshape[3*n+0] = .125*XI[n]*b*c;
+      dshape[3*n+1] = .125*ETA[n]*a*c;
+      dshape[3*n+2] = .125*MU[n]*a*b;
+    }
+  } else if (nDims == 2) {
+    shape_quad(loc,shape,nNodes);
+    dshape_quad(loc,dshape,nNodes);
+  } else {
+    shape_hex(loc,shape,nNodes);
+    dshape_hex(loc,dshape,nNodes);
+  }
+}
+
+/*! Newton inversion of x(loc) = pos for an element with nodal coordinates xn [nNodes x nDims],
+ *  using only fixed-size stack storage */
+static bool refLocNewton(const double *xn, int nNodes, int nDims, const point &pos, point &loc, bool useGuess)
 {
   // First, do a quick check to see if the point is even close to being in the element
-  double xmin, ymin, zmin;
-  double xmax, ymax, zmax;
-  xmin = ymin = zmin =  1e15;
-  xmax = ymax = zmax = -1e15;
   double eps = 1e-10;
 
-  auto box = getBoundingBox();
-  xmin = box[0];  ymin = box[1];  zmin = box[2];
-  xmax = box[3];  ymax = box[4];  zmax = box[5];
-
-  if (pos.x < xmin-eps || pos.y < ymin-eps || pos.z < zmin-eps ||
-      pos.x > xmax+eps || pos.y > ymax+eps || pos.z > zmax+eps) {
-    // Point does not lie within cell - return an obviously bad ref position
-    loc = {99.,99.,99.};
-    return false;
+  double xmin[3] = { INFINITY, INFINITY, INFINITY};
+  double xmax[3] = {-INFINITY,-INFINITY,-INFINITY};
+  for (int n = 0; n < nNodes; n++) {
+    for (int i = 0; i < nDims; i++) {
+      xmin[i] = min(xmin[i], xn[n*nDims+i]);
+      xmax[i] = max(xmax[i], xn[n*nDims+i]);
+    }
   }
 
-  // Use a relative tolerance to handle extreme grids
-  double h = min(xmax-xmin,ymax-ymin);
-  if (nDims==3) h = min(h,zmax-zmin);
+  double h = INFINITY;
+  for (int i = 0; i < nDims; i++) {
+    if (pos[i] < xmin[i]-eps || pos[i] > xmax[i]+eps) {
+      // Point does not lie within cell - return an obviously bad ref position
+      loc = {99.,99.,99.};
+      return false;
+    }
+    // Use a relative tolerance to handle extreme grids
+    h = min(h, xmax[i]-xmin[i]);
+  }
 
   double tol = 1e-12*h;
 
-  vector<double> shape(nNodes);
-  matrix<double> dshape(nNodes,nDims);
-  matrix<double> grad(nDims,nDims);
+  double shape[MAX_NEWTON_NODES];
+  double dshape[3*MAX_NEWTON_NODES];
+
+  if (useGuess) {
+    for (int i = 0; i < nDims; i++)
+      loc[i] = max(min(loc[i],1.01),-1.01);
+  } else {
+    loc = {0, 0, 0};
+  }
 
   int iter = 0;
   int iterMax = 20;
   double norm = 1;
-  loc = {0, 0, 0};
   while (norm > tol && iter<iterMax) {
-    if (nDims == 2) {
-      shape_quad(loc,shape,nNodes);
-      dshape_quad(loc,dshape,nNodes);
-    } else {
-      shape_hex(loc,shape,nNodes);
-      dshape_hex(loc,dshape,nNodes);
-    }
-
-    point dx = pos;
-    grad.initializeToZero();
-    if (params->motion) {
-      for (int n=0; n<nNodes; n++) {
-        for (int i=0; i<nDims; i++) {
-          for (int j=0; j<nDims; j++) {
-            grad(i,j) += nodesRK(n,i)*dshape(n,j);
-          }
-          dx[i] -= shape[n]*nodesRK(n,i);
-        }
-      }
-    } else {
-      for (int n=0; n<nNodes; n++) {
-        for (int i=0; i<nDims; i++) {
-          for (int j=0; j<nDims; j++) {
-            grad(i,j) += nodes(n,i)*dshape(n,j);
-          }
-          dx[i] -= shape[n]*nodes(n,i);
-        }
+    calcShapeNewton(loc,shape,dshape,nNodes,nDims);
+
+    double dx[3] = {pos.x, pos.y, pos.z};
+    double grad[3][3] = {{0,0,0},{0,0,0},{0,0,0}};
+    for (int n = 0; n < nNodes; n++) {
+      for (int i = 0; i < nDims; i++) {
+        double x = xn[n*nDims+i];
+        for (int j = 0; j < nDims; j++)
+          grad[i][j] += x*dshape[n*nDims+j];
+        dx[i] -= shape[n]*x;
       }
     }
 
-    double detJ = grad.det();
-
-    auto ginv = grad.adjoint();
-
     point delta = {0,0,0};
-    for (int i=0; i<nDims; i++)
-      for (int j=0; j<nDims; j++)
-        delta[i] += ginv(i,j)*dx[j]/detJ;
+    if (nDims == 2) {
+      double detJ = grad[0][0]*grad[1][1] - grad[0][1]*grad[1][0];
+      delta.x = ( grad[1][1]*dx[0] - grad[0][1]*dx[1]) / detJ;
+      delta.y = (-grad[1][0]*dx[0] + grad[0][0]*dx[1]) / detJ;
+    } else {
+      double inv[3][3];
+      inv[0][0] = grad[1][1]*grad[2][2] - grad[1][2]*grad[2][1];
+      inv[0][1] = grad[0][2]*grad[2][1] - grad[0][1]*grad[2][2];
+      inv[0][2] = grad[0][1]*grad[1][2] - grad[0][2]*grad[1][1];
+      inv[1][0] = grad[1][2]*grad[2][0] - grad[1][0]*grad[2][2];
+      inv[1][1] = grad[0][0]*grad[2][2] - grad[0][2]*grad[2][0];
+      inv[1][2] = grad[0][2]*grad[1][0] - grad[0][0]*grad[1][2];
+      inv[2][0] = grad[1][0]*grad[2][1] - grad[1][1]*grad[2][0];
+      inv[2][1] = grad[0][1]*grad[2][0] - grad[0][0]*grad[2][1];
+      inv[2][2] = grad[0][0]*grad[1][1] - grad[0][1]*grad[1][0];
+      double detJ = grad[0][0]*inv[0][0] + grad[0][1]*inv[1][0] + grad[0][2]*inv[2][0];
+      for (int i = 0; i < 3; i++)
+        delta[i] = (inv[i][0]*dx[0] + inv[i][1]*dx[1] + inv[i][2]*dx[2]) / detJ;
+    }
 
     bool shrink = false;
     for (int i = 0; i < nDims; i++)
@@ -583,6 +630,49 @@ bool ele::getRefLocNewton(point pos, point &loc)
     return false;
 }
 
+bool ele::getRefLocNewton(point pos, point &loc, bool useGuess)
+{
+  if (nNodes > MAX_NEWTON_NODES)
+    FatalError("Element has too many nodes for getRefLocNewton.");
+
+  double xn[3*MAX_NEWTON_NODES];
+  if (params->motion) {
+    for (int n = 0; n < nNodes; n++)
+      for (int i = 0; i < nDims; i++)
+        xn[n*nDims+i] = nodesRK(n,i);
+  } else {
+    for (int n = 0; n < nNodes; n++)
+      for (int i = 0; i < nDims; i++)
+        xn[n*nDims+i] = nodes(n,i);
+  }
+
+  return refLocNewton(xn,nNodes,nDims,pos,loc,useGuess);
+}
+
+void ele::getRefLocNewtonBatch(vector<shared_ptr<ele>> &eles, const vector<int> &eleIDs, const vector<point> &pos, vector<point> &loc, vector<char> &isInEle, const vector<int> &ptStart)
+{
+  int nPairs = eleIDs.size();
+  loc.resize(nPairs);
+  isInEle.assign(nPairs,0);
+
+  // Without ptStart, each pair is its own point
+  int nPts = ptStart.empty() ? nPairs : (int)ptStart.size()-1;
+
+#pragma omp parallel for schedule(dynamic)
+  for (int i = 0; i < nPts; i++) {
+    int kStart = ptStart.empty() ? i : ptStart[i];
+    int kEnd = ptStart.empty() ? i+1 : ptStart[i+1];
+
+    // Stop at the first candidate which contains the point
+    for (int k = kStart; k < kEnd; k++) {
+      if (eles[eleIDs[k]]->getRefLocNewton(pos[k],loc[k])) {
+        isInEle[k] = 1;
+        break;
+      }
+    }
+  }
+}
+
 double ele::getDxNelderMead(point refLoc, point physPos)
 {
   point pt = calcPos(refLoc);
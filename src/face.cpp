@@ -32,6 +32,7 @@
 
 #include "../include/flux.hpp"
 #include "../include/ele.hpp"
+#include "../include/points.hpp"
 
 void face::initialize(shared_ptr<ele> &eL, shared_ptr<ele> &eR, int gID, int locF_L, faceInfo myInfo, input *params)
 {
@@ -75,6 +76,7 @@ void face::setupFace(void)
   dAL.resize(nFptsL);
   //detJacL.resize(nFptsL);
   waveSp.resize(nFptsL);
+  wtsFace = getQptWeights(eL->order, nDims-1);
 
   Fn.initializeToZero();
 
@@ -114,6 +116,9 @@ void face::getPointers(void)
 
     fpt++;
   }
+
+  // waveSp_faces is only allocated for CFL-based time steps
+  waveSpFaceL = (params->dtType != 0) ? &(eL->waveSp_faces(locF_L)) : NULL;
 }
 
 void face::getLeftState()
@@ -189,6 +194,14 @@ void face::calcInviscidFlux(void)
     for (int j=0; j<nFields; j++)
       FnL[i][j] =  Fn(i,j)*dAL[i];
 
+  // Integrate wave speed over face for left ele's CFL-based time step
+  if (params->dtType != 0) {
+    double waveSpFace = 0;
+    for (int i=0; i<nFptsL; i++)
+      waveSpFace += (*waveSp[i]) * wtsFace[i] * dAL[i];
+    *waveSpFaceL = waveSpFace;
+  }
+
   if (params->viscous) {
 
     ldgSolution();
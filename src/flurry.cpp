@@ -49,9 +49,12 @@ int main(int argc, char *argv[]) {
   int rank = 0;
   int nproc = 1;
 #ifndef _NO_MPI
-  MPI_Init(&argc, &argv);
+  // The task-graph residual makes its MPI calls from the master thread
+  int provided = MPI_THREAD_SINGLE;
+  MPI_Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
   MPI_Comm_rank(MPI_COMM_WORLD, &rank);
   MPI_Comm_size(MPI_COMM_WORLD, &nproc);
+  params.mpiFunneled = (provided >= MPI_THREAD_FUNNELED);
 #endif
   params.rank = rank;
   params.nproc = nproc;
@@ -114,14 +117,9 @@ int main(int argc, char *argv[]) {
     Solver.initializeSolution();
   }
 
-  /* Write initial data file */
+  /* Write initial data file [in the background if params.asyncOutput] */
   writeData(&Solver,&params);
 
-#ifndef _NO_MPI
-  // Allow all processes to finish initial file writing before starting computation
-  MPI_Barrier(MPI_COMM_WORLD);
-#endif
-
   /* Start timer for simulation (ignoring pre-processing) */
   params.timer.startTimer();
 
@@ -141,14 +139,36 @@ int main(int argc, char *argv[]) {
     if (params.PMG)
       pmg.cycle(Solver);
 
+    /* Add the new solution to the running statistics */
+    if (params.calcStats && iter > params.statsStartIter && iter%params.statsFreq == 0)
+      Solver.accumulateStats();
+
     if ((iter)%params.monitorResFreq==0 or iter==initIter+1 or params.time>=maxTime) writeResidual(&Solver,&params);
     if ((iter)%params.monitorErrFreq==0 or iter==initIter+1) writeError(&Solver,&params);
     if ((iter)%params.plotFreq==0 or iter==iterMax or params.time>=maxTime) writeData(&Solver,&params);
+
+    /* Modal files can't be restarted from, so also write .vtu restart data */
+    if (params.plotType == 2 && params.restart_freq > 0 &&
+        ((iter)%params.restart_freq==0 or iter==iterMax or params.time>=maxTime))
+      writeParaview(&Solver,&params);
+
+    if (params.probeFreq > 0 && (iter)%params.probeFreq==0) writeProbes(&Solver,&params);
+    if (!params.plotRegions.empty()) writeRegions(&Solver,&params);
+
+    /* For moving overset grids, re-cut any grid whose ranks have fallen out of balance */
+    if (params.meshType == OVERSET_MESH && !params.PMG && params.rebalanceFreq > 0 && iter%params.rebalanceFreq == 0)
+      Solver.rebalance();
   }
 
+  /* Wait for any background plot-file writing to finish */
+  finishWriteData();
+
   /* Calculate the integral / L1 / L2 error for the final time */
   writeAllError(&Solver,&params);
 
+  /* For overset runs, suggest a better split of ranks between the grids for a fresh run */
+  writeGridBalance(&Solver,&params);
+
   // Get simulation wall time
   params.timer.stopTimer();
   params.timer.showTime();
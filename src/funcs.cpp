@@ -27,6 +27,7 @@
  */
 #include "funcs.hpp"
 
+#include <algorithm>
 #include <cmath>
 #include <set>
 
@@ -84,21 +85,27 @@ vector<double> solveCholesky(matrix<double> A, vector<double> b)
 }
 
 matrix<double> solveCholesky(matrix<double> A, matrix<double> &B)
+{
+  if (A.getDim0()!=A.getDim1()) FatalError("Cannot use Cholesky on non-square matrix.");
+
+  choleskyFactor(A);
+
+  matrix<double> x = B;
+  choleskySolve(A,x);
+
+  return x;
+}
+
+void choleskyFactor(matrix<double> &A)
 {
   double eps = 1e-12;
-  int m = A.getDim0();
-  int n = A.getDim1();
-  int p = B.getDim1();
-  if (m!=n) FatalError("Cannot use Cholesky on non-square matrix.");
+  int n = A.getDim0();
 
   // Get the Cholesky factorization of A [A = G*G^T]
   for (int j=0; j<n; j++) {
-    if (j>0) {
-      matrix<double> a = A.slice({{j,n-1}},{{0,j-1}});
-      vector<double> a1 = a.getRow(0);
-      a1 = a*a1;
-      for (int i=0; i<n-j; i++) A(j+i,j) -= a1[i];
-    }
+    for (int i=j; i<n; i++)
+      for (int k=0; k<j; k++)
+        A(i,j) -= A(i,k)*A(j,k);
 
     if (A(j,j)<0) {
       if (std::abs(A(j,j) < eps)) {
@@ -114,32 +121,68 @@ matrix<double> solveCholesky(matrix<double> A, matrix<double> &B)
       A(i,j) /= ajj;
     }
   }
+}
+
+void choleskySolve(matrix<double> &G, matrix<double> &B)
+{
+  int n = G.getDim0();
+  int p = B.getDim1();
 
   // Lower-Triangular Solve [G*Y = B]
-  matrix<double> y(n,p);
-  for (int k=0; k<p; k++) {
-    for (int i=0; i<n; i++) {
-      y(i,k) = B(i,k);
-      for (int j=0; j<i; j++) {
-        y(i,k) -= A(i,j)*y(j,k);
-      }
-      y(i,k) /= A(i,i);
-    }
+  for (int i=0; i<n; i++) {
+    for (int j=0; j<i; j++)
+      for (int k=0; k<p; k++)
+        B(i,k) -= G(i,j)*B(j,k);
+    for (int k=0; k<p; k++)
+      B(i,k) /= G(i,i);
   }
 
   // Upper-Triangular Solve [G^T*X = Y]
-  matrix<double> x(n,p);
-  for (int k=0; k<p; k++) {
-    for (int i=n-1; i>=0; i--) {
-      x(i,k) = y(i,k);
-      for (int j=i+1; j<n; j++) {
-        x(i,k) -= A(j,i)*x(j,k);
-      }
-      x(i,k) /= A(i,i);
-    }
+  for (int i=n-1; i>=0; i--) {
+    for (int j=i+1; j<n; j++)
+      for (int k=0; k<p; k++)
+        B(i,k) -= G(j,i)*B(j,k);
+    for (int k=0; k<p; k++)
+      B(i,k) /= G(i,i);
   }
+}
 
-  return x;
+bool isRigidMotion(input *params, int gridID)
+{
+  // Motion types 3-5 only move grid 0; type 4 is a rigid translation
+  return (params->motion == 0 || params->motion == 4 || (params->motion >= 3 && gridID != 0));
+}
+
+vector<int> splitProcsByCost(const vector<double> &cost, int nproc)
+{
+  int n = cost.size();
+  if (nproc < n) FatalError("Need at least one MPI rank per task.");
+
+  // Every task gets one rank; the rest are split by cost
+  double costSum = 0;
+  for (auto &c:cost) costSum += c;
+
+  vector<int> nProcs(n,1);
+  vector<double> remainder(n,0);
+  int nFree = nproc - n;
+  int nLeft = nFree;
+  for (int i=0; i<n; i++) {
+    double share = (costSum > 0) ? nproc*cost[i]/costSum - 1 : (double)nFree/n;
+    share = std::max(share, 0.);
+    int extra = std::min((int)share, nLeft);
+    nProcs[i] += extra;
+    nLeft -= extra;
+    remainder[i] = share - extra;
+  }
+
+  // Hand out the remaining ranks by largest remainder
+  for (; nLeft > 0; nLeft--) {
+    int i = std::max_element(remainder.begin(), remainder.end()) - remainder.begin();
+    nProcs[i]++;
+    remainder[i] -= 1;
+  }
+
+  return nProcs;
 }
 
 void shape_quad(const point &in_rs, vector<double> &out_shape, int nNodes)
@@ -31,12 +31,18 @@
 #include <algorithm>
 #include <array>
 #include <cstdlib>
+#include <cstring>
 #include <map>
 #include <memory>
 #include <set>
 #include <sstream>
 #include <unordered_set>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include "face.hpp"
 #include "intFace.hpp"
 #include "boundFace.hpp"
@@ -73,6 +79,13 @@ void geo::setup(input* params, bool HMG)
   rank = params->rank;
   nproc = params->nproc;
 
+  /* --- Re-use the pre-processed mesh from a previous run if possible --- */
+  bool useCache = (meshType == READ_MESH && params->meshCache && !HMG);
+  if (useCache && readMeshCache()) {
+    setupMeshMotion();
+    return;
+  }
+
   switch(meshType) {
     case READ_MESH:
       readGmsh(params->meshFileName);
@@ -113,6 +126,9 @@ void geo::setup(input* params, bool HMG)
     partitionMesh();
 #endif
     processConnectivity();
+
+    if (useCache)
+      writeMeshCache();
   }
 }
 
@@ -200,6 +216,11 @@ void geo::processConnectivity(int HMG_nSplit)
 #endif
 
   /* --- Additional setup for moving grids --- */
+  setupMeshMotion();
+}
+
+void geo::setupMeshMotion(void)
+{
   if (params->motion) {
     xv0.resize(nVerts);
     for (int i=0; i<nVerts; i++) xv0[i] = point(xv[i],nDims);
@@ -222,25 +243,32 @@ void geo::processConn2D(void)
 {
   /* --- Setup Edges --- */
 
-  matrix<int> e2v1;
-  vector<int> edge(2);
+  // Row of e2v1 holding each cell's edges [-1 for collapsed edges]
+  vector<int> c2row(nEles+1);
+  for (int e=0; e<nEles; e++)
+    c2row[e+1] = c2row[e] + c2nf[e];
 
+  vector<int> edgeRow(c2row[nEles],-1);
+  int nEdgeRows = 0;
   for (int e=0; e<nEles; e++) {
     for (int ie=0; ie<c2nf[e]; ie++) {  // NOTE: nv may be != ne for 3D
       int iep1 = (ie+1)%c2nf[e];
-      if (c2v(e,ie) == c2v(e,iep1)) {
-        // Collapsed edge - ignore
-        continue;
-      }
-      else if (c2v(e,ie) < c2v(e,iep1)) {
-        edge[0] = c2v(e,ie);
-        edge[1] = c2v(e,iep1);
-      }
-      else {
-        edge[0] = c2v(e,iep1);
-        edge[1] = c2v(e,ie);
-      }
-      e2v1.insertRow(edge);
+      if (c2v(e,ie) != c2v(e,iep1))
+        edgeRow[c2row[e]+ie] = nEdgeRows++;
+    }
+  }
+
+  matrix<int> e2v1(nEdgeRows,2);
+
+#pragma omp parallel for
+  for (int e=0; e<nEles; e++) {
+    for (int ie=0; ie<c2nf[e]; ie++) {
+      int row = edgeRow[c2row[e]+ie];
+      if (row < 0) continue; // Collapsed edge - ignore
+
+      int iep1 = (ie+1)%c2nf[e];
+      e2v1(row,0) = std::min(c2v(e,ie),c2v(e,iep1));
+      e2v1(row,1) = std::max(c2v(e,ie),c2v(e,iep1));
     }
   }
 
@@ -257,60 +285,12 @@ void geo::processConn2D(void)
 
   /* --- Generaate Internal and Boundary Face Lists --- */
 
-  /* Flag for whether global face ID corresponds to interior or boundary face
-     (note that, at this stage, MPI faces will be considered boundary faces) */
-  faceType.assign(nFaces,INTERNAL);
-
-  nIntFaces = 0;
-  nBndFaces = 0;
-  nMpiFaces = 0;
-
-  intFaces.resize(0);
-  bndFaces.resize(0);
-
-  for (uint i=0; i<iE.size(); i++) {
-    if (iE[i]!=-1) {
-      auto ie = findEq(iE,iE[i]);
-      if (ie.size()>2) {
-        stringstream ss; ss << i;
-        string errMsg = "More than 2 cells for edge " + ss.str();
-        FatalError(errMsg.c_str());
-      }
-      else if (ie.size()==2) {
-        // Internal Edge which has not yet been added
-        intFaces.push_back(iE[i]);
-        nIntFaces++;
-      }
-      else if (ie.size()==1) {
-        // Boundary or MPI Edge
-        bndFaces.push_back(iE[i]);
-        faceType[iE[i]] = BOUNDARY;
-        nBndFaces++;
-      }
-
-      // Mark edges as completed
-      vecAssign(iE,ie,-1);
-    }
-  }
+  setFaceTypes(iE);
 
   /* --- Match Boundary Faces to Boundary Conditions --- */
 
-  bcFaces.resize(nBounds);
   bcType.assign(nBndFaces,-1);
-  bcID.resize(nBndFaces);
-  for (int i=0; i<nBndFaces; i++) {
-    int iv1 = f2v(bndFaces[i],0);
-    int iv2 = f2v(bndFaces[i],1);
-    for (int bnd=0; bnd<nBounds; bnd++) {
-      if (findFirst(bndPts[bnd],iv1,bndPts.dims[1])!=-1 && findFirst(bndPts[bnd],iv2,bndPts.dims[1])!=-1) {
-        // The edge lies on this boundary
-        bcType[i] = bcList[bnd];
-        bcID[i] = bnd;
-        bcFaces[bnd].insertRow(f2v[bndFaces[i]],INSERT_AT_END,f2v.dims[1]);
-        break;
-      }
-    }
-  }
+  matchBoundaryFaces();
 
   /* --- Setup Cell-To-Edge, Edge-To-Cell --- */
 
@@ -324,37 +304,17 @@ void geo::processConn2D(void)
 
   for (int ic=0; ic<nEles; ic++) {
     for (int j=0; j<c2nf[ic]; j++) {
-      int jp1 = (j+1)%(c2nf[ic]);
-
-      // Store edges consistently to allow matching of duplicates
-      if (c2v(ic,j) == c2v(ic,jp1)) {
+      int row = edgeRow[c2row[ic]+j];
+      if (row < 0) {
         // Collapsed edge; ignore
         c2f(ic,j) = -1;
         c2b(ic,j) = 0;
         continue;
       }
 
-      if (c2v(ic,j) < c2v(ic,jp1)) {
-        edge[0] = c2v(ic,j);
-        edge[1] = c2v(ic,jp1);
-      } else {
-        edge[0] = c2v(ic,jp1);
-        edge[1] = c2v(ic,j);
-      }
-
-      auto ie1 = findEq(f2v.getCol(0),edge[0]);
-      auto col2 = (f2v.getRows(ie1)).getCol(1);
-      int ie2 = findFirst(col2,edge[1]);
-      int ie0 = ie1[ie2];
-
-      // Find ID of face within type-specific array
-      if (faceType[ie0]>0) {
-        c2f(ic,j) = ie0;
-        c2b(ic,j) = 1;
-      }else{
-        c2f(ic,j) = ie0;
-        c2b(ic,j) = 0;
-      }
+      int ie0 = iE[row];
+      c2f(ic,j) = ie0;
+      c2b(ic,j) = (faceType[ie0]>0) ? 1 : 0;
 
       if (f2c(ie0,0) == -1) {
         // No cell yet assigned to edge; put on left
@@ -364,8 +324,7 @@ void geo::processConn2D(void)
         f2c(ie0,1) = ic;
         // Update c2c for both cells
         int ic2 = f2c(ie0,0);
-        vector<int> cellFaces(c2f[ic2],c2f[ic2]+c2nf[ic2]);
-        int fid2 = findFirst(cellFaces,ie0);
+        int fid2 = findFirst(c2f[ic2],ie0,c2nf[ic2]);
         c2c(ic,j)     = ic2;
         c2c(ic2,fid2) = ic;
       }
@@ -377,9 +336,6 @@ void geo::processConn3D(void)
 {
   /* --- Setup Single List of All Faces (sorted vertex lists) --- */
 
-  matrix<int> f2v1, e2v1;
-  vector<int> f2nv1;
-
   // Handy map to store local face-vertex lists for each ele type
   map<int,matrix<int>> ct2fv;
   map<int,vector<int>> ct2fnv;
@@ -394,34 +350,51 @@ void geo::processConn3D(void)
   //ct2fnv[PRISM] = {3,3,4,4,4};
   //ct2fnv[TET] = {3,3,3,3};
 
+  // Only quadrilateral faces [of hexahedra] are currently supported
+  const int maxFnv = 4;
+
+  for (int e=0; e<nEles; e++)
+    if (!ct2fv.count(ctype[e]))
+      FatalError("Element type not supported for 3D connectivity.");
+
+  // Row of f2v1 holding each cell's faces [each face's 4 edges are in e2v1]
+  vector<int> c2row(nEles+1);
+  for (int e=0; e<nEles; e++)
+    c2row[e+1] = c2row[e] + c2nf[e];
+  int nFaceRows = c2row[nEles];
+
+  matrix<int> f2v1(nFaceRows,maxFnv), e2v1(4*nFaceRows,2);
+  vector<int> f2nv1(nFaceRows);
+
+#pragma omp parallel for
   for (int e=0; e<nEles; e++) {
+    auto &fv = ct2fv.at(ctype[e]);
+    auto &fnv = ct2fnv.at(ctype[e]);
+
     for (int f=0; f<c2nf[e]; f++) {
-      // Get local vertex list for face
-      auto iface = ct2fv[ctype[e]].getRow(f);
+      int row = c2row[e] + f;
 
       // Get global vertex list for face
-      vector<int> facev(ct2fnv[ctype[e]][f]);
-      for (int i=0; i<ct2fnv[ctype[e]][f]; i++) {
-        facev[i] = c2v(e,iface[i]);
+      int *facev = f2v1[row];
+      for (int i=0; i<fnv[f]; i++) {
+        facev[i] = c2v(e,fv(f,i));
         if (i>0 && facev[i] == facev[i-1]) facev[i] = -1;
       }
 
       // Sort the vertices for easier comparison later
-      std::sort(facev.begin(),facev.end());
-      f2v1.insertRowUnsized(facev);
-      f2nv1.push_back(ct2fnv[ctype[e]][f]);
+      std::sort(facev,facev+maxFnv);
+      f2nv1[row] = fnv[f];
 
-      e2v1.insertRow({facev[0],facev[1]});
-      e2v1.insertRow({facev[1],facev[2]});
-      e2v1.insertRow({facev[2],facev[3]});
-      e2v1.insertRow({facev[0],facev[3]});
+      int *edges = e2v1[4*row];
+      edges[0] = facev[0];  edges[1] = facev[1];
+      edges[2] = facev[1];  edges[3] = facev[2];
+      edges[4] = facev[2];  edges[5] = facev[3];
+      edges[6] = facev[0];  edges[7] = facev[3];
     }
   }
 
   /* --- Get a unique list of faces --- */
 
-  // NOTE: Could setup f2c here, but I already have another algorithm implemented later
-
   // iE is of length [original f2v1] with range [final f2v]
   // The number of times a face appears in iF is equal to
   // the number of cells that face touches
@@ -438,64 +411,12 @@ void geo::processConn3D(void)
 
   /* --- Generate Internal and Boundary Face Lists --- */
 
-  // Flag for whether global face ID corresponds to interior or boundary face
-  // (note that, at this stage, MPI faces will be considered boundary faces)
-  faceType.assign(nFaces,INTERNAL);
-
-  nIntFaces = 0;
-  nBndFaces = 0;
-  nMpiFaces = 0;
-
-  for (uint i=0; i<iF.size(); i++) {
-    if (iF[i]!=-1) {
-      auto ff = findEq(iF,iF[i]);
-      if (ff.size()>2) {
-        stringstream ss; ss << i;
-        string errMsg = "More than 2 cells for face " + ss.str();
-        FatalError(errMsg.c_str());
-      }
-      else if (ff.size()==2) {
-        // Internal Edge which has not yet been added
-        intFaces.push_back(iF[i]);
-        nIntFaces++;
-      }
-      else if (ff.size()==1) {
-        // Boundary or MPI Edge
-        bndFaces.push_back(iF[i]);
-        faceType[iF[i]] = BOUNDARY;
-        nBndFaces++;
-      }
-
-      // Mark edges as completed
-      vecAssign(iF,ff,-1);
-    }
-  }
+  setFaceTypes(iF);
 
   /* --- Match Boundary Faces to Boundary Conditions --- */
 
-  bcFaces.resize(nBounds);
   bcType.assign(nBndFaces,NONE);
-  bcID.resize(nBndFaces);
-  for (int i=0; i<nBndFaces; i++) {
-    for (int bnd=0; bnd<nBounds; bnd++) {
-      bool isOnBound = true;
-      for (int j=0; j<f2nv[bndFaces[i]]; j++) {
-        if (findFirst(bndPts[bnd],f2v(bndFaces[i],j),bndPts.dims[1]) == -1) {
-          isOnBound = false;
-          break;
-        }
-      }
-
-      if (isOnBound) {
-        //cout << "bndFace matched to bc " << bcList[bnd] << endl;
-        // The edge lies on this boundary
-        bcType[i] = bcList[bnd];
-        bcID[i] = bnd;
-        bcFaces[bnd].insertRow(f2v[bndFaces[i]],INSERT_AT_END,f2v.dims[1]);
-        break;
-      }
-    }
-  }
+  matchBoundaryFaces();
 
   /* --- Setup Cell-To-Face, Face-To-Cell --- */
 
@@ -509,40 +430,20 @@ void geo::processConn3D(void)
   f2c.initializeToValue(-1);
 
   for (int ic=0; ic<nEles; ic++) {
-    for (int j=0; j<c2nf[ic]; j++) {
-      // Get local vertex list for face
-      auto iface = ct2fv[ctype[ic]].getRow(j);
-
-      // Get global vertex list for face
-      int fnv = ct2fnv[ctype[ic]][j];
-      vector<int> facev(fnv);
-      for (int i=0; i<fnv; i++)
-        facev[i] = c2v(ic,iface[i]);
-
-      // Sort the vertices for easier comparison
-      std::sort(facev.begin(),facev.end());
-
-      bool found = false;
+    auto &fv = ct2fv.at(ctype[ic]);
+    auto &fnv = ct2fnv.at(ctype[ic]);
 
+    for (int j=0; j<c2nf[ic]; j++) {
       // Check if face is actually collapsed (nonexistant) (all nodes identical)
       bool collapsed = true;
-      for (int i=1; i<fnv; i++)
-        collapsed = ( collapsed && (facev[0]==facev[i]) );
+      for (int i=1; i<fnv[j]; i++)
+        collapsed = ( collapsed && (c2v(ic,fv(j,0)) == c2v(ic,fv(j,i))) );
 
       if (collapsed)
         continue;
 
-      for (int f=0; f<nFaces; f++) {
-        if (std::equal(f2v[f],f2v[f]+fnv,facev.begin())) {
-          found = true;
-          c2f(ic,j) = f;
-          break;
-        }
-      }
-
-      if (!found) FatalError("Unable to match cell face to global face list!");
-
-      int ff = c2f(ic,j);
+      int ff = iF[c2row[ic]+j];
+      c2f(ic,j) = ff;
 
       // Find ID of face within type-specific array
       if (faceType[ff]>0)
@@ -559,8 +460,7 @@ void geo::processConn3D(void)
         // Update c2c for both cells
         int ic2 = f2c(ff,0);
         if (ic2 != ic) {
-          vector<int> cellFaces(c2f[ic2],c2f[ic2]+c2nf[ic2]);
-          int fid2 = findFirst(cellFaces,ff);
+          int fid2 = findFirst(c2f[ic2],ff,c2nf[ic2]);
           c2c(ic,j)     = ic2;
           c2c(ic2,fid2) = ic;
         }
@@ -569,61 +469,119 @@ void geo::processConn3D(void)
   }
 }
 
-void geo::processConnExtra(void)
+void geo::setFaceTypes(const vector<int> &iF)
 {
-  int maxNC;
-  if (nDims == 2)
-    maxNC = 8;
-  else
-    maxNC = 26;
+  // Flag for whether global face ID corresponds to interior or boundary face
+  // (note that, at this stage, MPI faces will be considered boundary faces)
+  vector<int> nCellsF(nFaces,0);
+  for (auto &ff:iF)
+    nCellsF[ff]++;
 
-  getBoundingBox(xv,minPt,maxPt);
+  faceType.assign(nFaces,INTERNAL);
 
-  // Get vertex to vertex/edge connectivity
-  vector<set<int>> v2v_tmp(nVerts);
-  vector<set<int>> v2e_tmp(nVerts);
-  if (nDims == 2) {
-    // Faces are the edges
-    for (int ie=0; ie<nFaces; ie++) {
-      int iv1 = f2v(ie,0);
-      int iv2 = f2v(ie,1);
-      v2v_tmp[iv1].insert(iv2);
-      v2v_tmp[iv2].insert(iv1);
-      v2e_tmp[iv1].insert(ie);
-      v2e_tmp[iv2].insert(ie);
+  intFaces.resize(0);
+  bndFaces.resize(0);
+
+  for (int ff=0; ff<nFaces; ff++) {
+    if (nCellsF[ff]>2) {
+      stringstream ss; ss << ff;
+      string errMsg = "More than 2 cells for face " + ss.str();
+      FatalError(errMsg.c_str());
     }
-  } else {
-    // Edges were processed separately for 3D
-    for (int ie=0; ie<nEdges; ie++) {
-      int iv1 = e2v(ie,0);
-      int iv2 = e2v(ie,1);
-      v2v_tmp[iv1].insert(iv2);
-      v2v_tmp[iv2].insert(iv1);
-      v2e_tmp[iv1].insert(ie);
-      v2e_tmp[iv2].insert(ie);
+    else if (nCellsF[ff]==2) {
+      // Internal face
+      intFaces.push_back(ff);
+    }
+    else {
+      // Boundary or MPI face
+      bndFaces.push_back(ff);
+      faceType[ff] = BOUNDARY;
     }
   }
 
-  v2nv.resize(nVerts);
-  for (int iv=0; iv<nVerts; iv++) {
-    v2nv[iv] = v2v_tmp[iv].size();
-  }
+  nIntFaces = intFaces.size();
+  nBndFaces = bndFaces.size();
+  nMpiFaces = 0;
+}
 
-  v2v.setup(nVerts,getMax(v2nv));
-  v2e.setup(nVerts,getMax(v2nv));
-  for (int iv=0; iv<nVerts; iv++) {
-    int j = 0;
-    for (auto &iv2:v2v_tmp[iv]) {
-      v2v(iv,j) = iv2;
-      j++;
-    }
+void geo::matchBoundaryFaces(void)
+{
+  // Flag the vertices on each boundary
+  vector<char> onBound((size_t)nBounds*nVerts,0);
+  for (int bnd=0; bnd<nBounds; bnd++)
+    for (int j=0; j<nBndPts[bnd]; j++)
+      onBound[(size_t)bnd*nVerts+bndPts(bnd,j)] = 1;
 
-    j = 0;
-    for (auto &ie:v2e_tmp[iv]) {
-      v2e(iv,j) = ie;
-      j++;
+  bcID.resize(nBndFaces);
+
+#pragma omp parallel for
+  for (int i=0; i<nBndFaces; i++) {
+    int ff = bndFaces[i];
+    for (int bnd=0; bnd<nBounds; bnd++) {
+      bool isOnBound = true;
+      for (int j=0; j<f2nv[ff]; j++) {
+        int iv = f2v(ff,j);
+        if (iv < 0 || !onBound[(size_t)bnd*nVerts+iv]) {
+          isOnBound = false;
+          break;
+        }
+      }
+
+      if (isOnBound) {
+        // The face lies on this boundary
+        bcType[i] = bcList[bnd];
+        bcID[i] = bnd;
+        break;
+      }
     }
   }
+
+  bcFaces.assign(nBounds,matrix<int>());
+  for (int i=0; i<nBndFaces; i++)
+    if (bcType[i] != NONE)
+      bcFaces[bcID[i]].insertRow(f2v[bndFaces[i]],INSERT_AT_END,f2v.dims[1]);
+}
+
+void geo::processConnExtra(void)
+{
+  getBoundingBox(xv,minPt,maxPt);
+
+  // Faces are the edges in 2D; edges were processed separately for 3D
+  matrix<int> &edges = (nDims == 2) ? f2v : e2v;
+  int nEdgesTot = (nDims == 2) ? nFaces : nEdges;
+
+  /* --- Get vertex to vertex/edge connectivity [CSR] --- */
+
+  v2nv.assign(nVerts,0);
+  for (int ie=0; ie<nEdgesTot; ie++) {
+    int iv1 = edges(ie,0);
+    int iv2 = edges(ie,1);
+    if (iv1 < 0 || iv1 == iv2) continue;  // Edge of a collapsed face
+    v2nv[iv1]++;
+    v2nv[iv2]++;
+  }
+
+  v2vPtr.assign(nVerts+1,0);
+  for (int iv=0; iv<nVerts; iv++)
+    v2vPtr[iv+1] = v2vPtr[iv] + v2nv[iv];
+
+  v2v.resize(v2vPtr[nVerts]);
+  v2e.resize(v2vPtr[nVerts]);
+  vector<int> nAdded(nVerts,0);
+  for (int ie=0; ie<nEdgesTot; ie++) {
+    int iv1 = edges(ie,0);
+    int iv2 = edges(ie,1);
+    if (iv1 < 0 || iv1 == iv2) continue;
+    int j1 = v2vPtr[iv1] + nAdded[iv1]++;
+    int j2 = v2vPtr[iv2] + nAdded[iv2]++;
+    v2v[j1] = iv2;  v2e[j1] = ie;
+    v2v[j2] = iv1;  v2e[j2] = ie;
+  }
+
+  // Edges were added in order, so only the neighbouring vertices need sorting
+#pragma omp parallel for
+  for (int iv=0; iv<nVerts; iv++)
+    std::sort(&v2v[v2vPtr[iv]], &v2v[v2vPtr[iv+1]]);
 }
 
 void geo::matchMPIFaces(void)
@@ -959,7 +917,10 @@ void geo::setupElesFaces(input *params, vector<shared_ptr<ele>> &eles, vector<sh
         int relRot = 0;
         if (nDims == 3) {
           // Find the relative orientation (rotation) between left & right faces
-          relRot = compareOrientationMPI(ic,fid1,gIC_R[i],mpiLocF_R[i],mpiPeriodic[i]);
+          if (mpiRelRot.size())
+            relRot = mpiRelRot[i];
+          else
+            relRot = compareOrientationMPI(ic,fid1,gIC_R[i],mpiLocF_R[i],mpiPeriodic[i]);
         }
         struct faceInfo info;
         info.IDR = faceID_R[i];
@@ -1018,9 +979,291 @@ void geo::setupElesFaces(input *params, vector<shared_ptr<ele>> &eles, vector<sh
   }
 }
 
+/*! Read-only memory map of a mesh file, with an allocation-free cursor for
+ *  parsing its ASCII text or its binary data blocks */
+class meshFileMap
+{
+public:
+  meshFileMap(string fileName)
+  {
+    int fd = open(fileName.c_str(), O_RDONLY);
+    if (fd < 0)
+      FatalError("Unable to open mesh file.");
+
+    struct stat st;
+    fstat(fd, &st);
+    size = st.st_size;
+
+    void *map = mmap(NULL, std::max(size,(size_t)1), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+      FatalError("Unable to map mesh file into memory.");
+
+    madvise(map, size, MADV_SEQUENTIAL);
+
+    start = pos = (const char*)map;
+    end = start + size;
+  }
+
+  ~meshFileMap(void)
+  {
+    munmap((void*)start, std::max(size,(size_t)1));
+  }
+
+  //! Move to the line after the first line starting with tag; false if not found
+  bool findSection(const char *tag)
+  {
+    size_t len = strlen(tag);
+    const char *p = start;
+    while (p && p + len <= end) {
+      if (!strncmp(p, tag, len)) {
+        pos = p;
+        skipLine();
+        return true;
+      }
+      p = (const char*)memchr(p, '\n', end - p);
+      if (p) p++;
+    }
+    return false;
+  }
+
+  //! Skip past the end of the current line
+  void skipLine(void)
+  {
+    const char *p = (const char*)memchr(pos, '\n', end - pos);
+    pos = (p) ? p+1 : end;
+  }
+
+  //! Skip spaces on the current line; true if nothing else is left on it
+  bool endOfLine(void)
+  {
+    while (pos < end && (*pos == ' ' || *pos == '\t' || *pos == '\r')) pos++;
+    return (pos >= end || *pos == '\n');
+  }
+
+  //! Get the rest of the current line
+  void getLine(string &str)
+  {
+    const char *p = (const char*)memchr(pos, '\n', end - pos);
+    if (!p) p = end;
+    str.assign(pos, p);
+    pos = (p < end) ? p+1 : end;
+  }
+
+  int getInt(void)
+  {
+    skipSpace();
+
+    bool neg = (pos < end && *pos == '-');
+    if (neg || (pos < end && *pos == '+')) pos++;
+
+    if (pos >= end || *pos < '0' || *pos > '9')
+      FatalError("Invalid integer in mesh file.");
+
+    int val = 0;
+    while (pos < end && *pos >= '0' && *pos <= '9')
+      val = 10*val + (*(pos++) - '0');
+
+    return (neg) ? -val : val;
+  }
+
+  double getDouble(void)
+  {
+    skipSpace();
+
+    // Copy the token to the stack so strtod can't run past the end of the map
+    char buf[64];
+    int n = 0;
+    while (pos < end && n < 63 && !isspace(*pos))
+      buf[n++] = *(pos++);
+    buf[n] = '\0';
+
+    char *tail;
+    double val = strtod(buf, &tail);
+    if (n == 0 || *tail != '\0')
+      FatalError("Invalid floating-point value in mesh file.");
+
+    return val;
+  }
+
+  //! Copy n values of binary data from the file
+  template<typename T>
+  void getBinary(T *data, size_t n)
+  {
+    if (pos + n*sizeof(T) > end)
+      FatalError("Unexpected end of binary mesh file.");
+
+    memcpy(data, pos, n*sizeof(T));
+    pos += n*sizeof(T);
+  }
+
+  //! Whether the whole file has been read
+  bool atEnd(void) { return pos >= end; }
+
+  //! 64-bit FNV-1a-style hash of the whole file [8 bytes at a time]
+  uint64_t hash(void)
+  {
+    uint64_t h = 14695981039346656037ULL;
+    const char *p = start;
+    for (; p + 8 <= end; p += 8) {
+      uint64_t w;
+      memcpy(&w, p, 8);
+      h = (h ^ w) * 1099511628211ULL;
+      h ^= h >> 32;
+    }
+    for (; p < end; p++)
+      h = (h ^ (unsigned char)*p) * 1099511628211ULL;
+
+    return h ^ size;
+  }
+
+private:
+  const char *start, *end, *pos;
+  size_t size;
+
+  void skipSpace(void)
+  {
+    while (pos < end && isspace(*pos)) pos++;
+  }
+};
+
+//! Number of nodes of each Gmsh element type [0 if not known]
+static int gmshNodesPerEle(int eType)
+{
+  switch(eType) {
+    case 1: return 2;    // Linear edge
+    case 2: return 3;    // Linear triangle
+    case 3: return 4;    // Linear quad
+    case 4: return 4;    // Linear tet
+    case 5: return 8;    // Linear hex
+    case 6: return 6;    // Linear prism
+    case 7: return 5;    // Linear pyramid
+    case 8: return 3;    // Quadratic edge
+    case 9: return 6;    // Quadratic triangle
+    case 10: return 9;   // Quadratic (Lagrange) quad
+    case 11: return 10;  // Quadratic tet
+    case 12: return 27;  // Quadratic (Lagrange) hex
+    case 15: return 1;   // Point
+    case 16: return 8;   // Quadratic (Serendipity) quad
+    case 17: return 20;  // Quadratic (Serendipity) hex
+    case 26: return 4;   // Cubic edge
+    case 27: return 5;   // Quartic edge
+    case 28: return 6;   // Quintic edge
+    case 36: return 16;  // Cubic quad
+    case 37: return 25;  // Quartic quad
+    case 38: return 36;  // Quintic quad
+    case 47: return 49;  // Order-6 quad
+    case 48: return 64;  // Order-7 quad
+    case 49: return 81;  // Order-8 quad
+    case 50: return 100; // Order-9 quad
+    case 51: return 121; // Order-10 quad
+    case 62: return 7;   // Order-6 edge
+    case 63: return 8;   // Order-7 edge
+    case 64: return 9;   // Order-8 edge
+    case 65: return 10;  // Order-9 edge
+    case 66: return 11;  // Order-10 edge
+    case 92: return 64;  // Cubic hex
+    case 93: return 125; // Quartic hex
+    case 94: return 216; // Quintic hex
+    default: return 0;
+  }
+}
+
+void geo::countGmshCells(string fileName, int &nCells, int &nOverFaces)
+{
+  meshFileMap meshFile(fileName);
+
+  if (!meshFile.findSection("$MeshFormat"))
+    FatalError("$MeshFormat tag not found in Gmsh file!");
+
+  meshFile.getDouble();
+  bool binary = (meshFile.getInt() == 1);
+  meshFile.skipLine();
+  if (binary) {
+    int one;
+    meshFile.getBinary(&one,1);
+  }
+
+  /* --- Find the Gmsh physical IDs of the fluid & overset-boundary regions --- */
+
+  if (!meshFile.findSection("$PhysicalNames"))
+    FatalError("$PhysicalNames tag not found in Gmsh file!");
+
+  int nNames = meshFile.getInt();
+  meshFile.skipLine();
+
+  map<int,int> bcIds;  // Gmsh physical ID -> Flurry boundary condition [-1 for fluid]
+  for (int i=0; i<nNames; i++) {
+    string str, bcStr;
+    stringstream ss;
+    int bcdim, bcid;
+
+    meshFile.getLine(str);
+    ss << str;
+    ss >> bcdim >> bcid >> bcStr;
+
+    bcStr.erase(std::remove(bcStr.begin(), bcStr.end(), '\"'), bcStr.end());
+    std::transform(bcStr.begin(), bcStr.end(), bcStr.begin(), ::tolower);
+
+    // Unrecognized boundaries are reported when the mesh is actually read
+    if (params->meshBounds.count(bcStr) && bcStr2Num.count(params->meshBounds[bcStr])) {
+      // As in readGmsh, only "fluid" regions hold cells ["none" is a boundary]
+      string bc = params->meshBounds[bcStr];
+      bcIds[bcid] = (bc == "fluid") ? -1 : bcStr2Num[bc];
+    }
+  }
+
+  /* --- Count the elements in each region --- */
+
+  if (!meshFile.findSection("$Elements"))
+    FatalError("$Elements tag not found in Gmsh file!");
+
+  int nElesGmsh = meshFile.getInt();
+  meshFile.skipLine();
+
+  nCells = 0;
+  nOverFaces = 0;
+
+  vector<int> eleData;
+  int blockEles = 0, nTags = 0;
+
+  for (int k=0; k<nElesGmsh; k++) {
+    if (binary) {
+      if (blockEles == 0) {
+        int header[3];
+        meshFile.getBinary(header,3);
+        blockEles = header[1];
+        nTags = header[2];
+        int nNodes = gmshNodesPerEle(header[0]);
+        if (nNodes == 0)
+          FatalError("element type not recognized");
+        eleData.resize(1 + nTags + nNodes);
+      }
+
+      meshFile.getBinary(eleData.data(), eleData.size());
+      blockEles--;
+    }
+    else {
+      eleData.resize(2);
+      eleData[0] = meshFile.getInt();
+      meshFile.getInt();  // Element type
+      nTags = meshFile.getInt();
+      eleData[1] = (nTags > 0) ? meshFile.getInt() : -1;
+      meshFile.skipLine();
+    }
+
+    auto it = bcIds.find(eleData[1]);
+    if (it == bcIds.end()) continue;
+
+    if (it->second == -1)
+      nCells++;
+    else if (it->second == OVERSET)
+      nOverFaces++;
+  }
+}
+
 void geo::readGmsh(string fileName)
 {
-  ifstream meshFile;
   string str;
 
   if (meshType == OVERSET_MESH) {
@@ -1030,22 +1273,40 @@ void geo::readGmsh(string fileName)
     if (gridRank==0) cout << "Geo: Reading mesh file " << fileName << endl;
   }
 
-  meshFile.open(fileName.c_str());
-  if (!meshFile.is_open())
-    FatalError("Unable to open mesh file.");
+  meshFileMap meshFile(fileName);
 
-  /* --- Read Boundary Conditions & Fluid Field(s) --- */
+  /* --- Read File Format: MSH version 2, ASCII or binary --- */
+
+  if (!meshFile.findSection("$MeshFormat"))
+    FatalError("$MeshFormat tag not found in Gmsh file!");
+
+  double version = meshFile.getDouble();
+  int fileType = meshFile.getInt();
+  int dataSize = meshFile.getInt();
+  meshFile.skipLine();
 
-  // Move cursor to $PhysicalNames
-  while(1) {
-    getline(meshFile,str);
-    if (str.find("$PhysicalNames")!=string::npos) break;
-    if(meshFile.eof()) FatalError("$PhysicalNames tag not found in Gmsh file!");
+  if (version < 2 || version >= 3)
+    FatalError("Only version 2 Gmsh files are supported.");
+
+  bool binary = (fileType == 1);
+  if (binary) {
+    if (dataSize != sizeof(double))
+      FatalError("Binary Gmsh file must use 8-byte floating-point data.");
+
+    int one;
+    meshFile.getBinary(&one,1);
+    if (one != 1)
+      FatalError("Binary Gmsh file was written with a different byte order.");
   }
 
+  /* --- Read Boundary Conditions & Fluid Field(s) --- */
+
+  if (!meshFile.findSection("$PhysicalNames"))
+    FatalError("$PhysicalNames tag not found in Gmsh file!");
+
   // Read number of boundaries and fields defined
-  meshFile >> nGmshBnds;
-  getline(meshFile,str);  // clear rest of line
+  nGmshBnds = meshFile.getInt();
+  meshFile.skipLine();  // clear rest of line
 
   nBounds = 0;
   for (int i=0; i<nGmshBnds; i++) {
@@ -1053,7 +1314,7 @@ void geo::readGmsh(string fileName)
     stringstream ss;
     int bcdim, bcid;
 
-    getline(meshFile,str);
+    meshFile.getLine(str);
     ss << str;
     ss >> bcdim >> bcid >> bcStr;
 
@@ -1099,63 +1360,98 @@ void geo::readGmsh(string fileName)
 
   /* --- Read Mesh Vertex Locations --- */
 
-  // Move cursor to $Nodes
-  meshFile.clear();
-  meshFile.seekg(0, ios::beg);
-  while(1) {
-    getline(meshFile,str);
-    if (str.find("$Nodes")!=string::npos) break;
-    if(meshFile.eof()) FatalError("$Nodes tag not found in Gmsh file!");
-  }
+  if (!meshFile.findSection("$Nodes"))
+    FatalError("$Nodes tag not found in Gmsh file!");
 
-  uint iv;
-  meshFile >> nVerts;
+  nVerts = meshFile.getInt();
   xv.setup(nVerts,nDims);
-  getline(meshFile,str); // Clear end of line, just in case
+  meshFile.skipLine(); // Clear end of line, just in case
 
   for (int i=0; i<nVerts; i++) {
-    meshFile >> iv >> xv(i,0) >> xv(i,1);
-    if (nDims == 3) meshFile >> xv(i,2);
-    getline(meshFile,str);
+    if (binary) {
+      // Node tag, then x,y,z [always 3D]
+      int iv;
+      double pos[3];
+      meshFile.getBinary(&iv,1);
+      meshFile.getBinary(pos,3);
+      for (int dim=0; dim<nDims; dim++)
+        xv(i,dim) = pos[dim];
+    }
+    else {
+      meshFile.getInt();
+      xv(i,0) = meshFile.getDouble();
+      xv(i,1) = meshFile.getDouble();
+      if (nDims == 3) xv(i,2) = meshFile.getDouble();
+      meshFile.skipLine();
+    }
   }
 
   /* --- Read Element Connectivity --- */
 
-  // Move cursor to $Elements
-  meshFile.clear();
-  meshFile.seekg(0, ios::beg);
-  while(1) {
-    getline(meshFile,str);
-    if (str.find("$Elements")!=string::npos) break;
-    if(meshFile.eof()) FatalError("$Elements tag not found in Gmsh file!");
-  }
+  if (!meshFile.findSection("$Elements"))
+    FatalError("$Elements tag not found in Gmsh file!");
 
   int nElesGmsh;
   vector<int> c2v_tmp(27,0);  // Maximum number of nodes/element possible
-  vector<set<int>> boundPoints(nBounds);
-//  bndPtsGmsh.resize(nGmshBnds);
-  map<int,int> eType2nv;
-  eType2nv[3] = 4;  // Linear quad
-  eType2nv[16] = 4; // Quadratic serendipity quad
-  eType2nv[10] = 4; // Quadratic Lagrange quad
-  eType2nv[8] = 8;  // Linear hex
+  vector<int> c2v_flat;       // Gmsh nodes of each interior element, in order
+  vector<vector<int>> boundPoints(nBounds);
 
   nBndPts.resize(nBounds);
 
   // Read total number of interior + boundary elements
-  meshFile >> nElesGmsh;
-  getline(meshFile,str);    // Clear end of line, just in case
+  nElesGmsh = meshFile.getInt();
+  meshFile.skipLine();    // Clear end of line, just in case
+
+  c2nv.reserve(nElesGmsh);
+  c2nf.reserve(nElesGmsh);
+  ctype.reserve(nElesGmsh);
+
+  // Each element's data: [Gmsh ID, tags..., nodes...] [re-used between elements]
+  vector<int> eleData;
+  int blockType = 0, blockEles = 0, nTags = 0, nNodes = 0;
 
   // For Gmsh node ordering, see: http://geuz.org/gmsh/doc/texinfo/gmsh.html#Node-ordering
-  int ic = 0;
   for (int k=0; k<nElesGmsh; k++) {
-    int id, eType, nTags, bcid, tmp;
-    meshFile >> id >> eType >> nTags;
-    meshFile >> bcid;
-    int gmshID = bcid;
-    bcid = bcIdMap[bcid];
-    for (int tag=0; tag<nTags-1; tag++)
-      meshFile >> tmp;
+    int eType;
+
+    if (binary) {
+      // Elements come in blocks of one type: [type, # of elements, # of tags]
+      if (blockEles == 0) {
+        int header[3];
+        meshFile.getBinary(header,3);
+        blockType = header[0];
+        blockEles = header[1];
+        nTags = header[2];
+        nNodes = gmshNodesPerEle(blockType);
+        if (nNodes == 0) {
+          cout << "Gmsh element ID " << k << ", Gmsh Element Type = " << blockType << endl;
+          FatalError("element type not recognized");
+        }
+        eleData.resize(1 + nTags + nNodes);
+      }
+
+      eType = blockType;
+      meshFile.getBinary(eleData.data(), eleData.size());
+      blockEles--;
+    }
+    else {
+      eleData.resize(1);
+      eleData[0] = meshFile.getInt();
+      eType = meshFile.getInt();
+      nTags = meshFile.getInt();
+      while (!meshFile.endOfLine())
+        eleData.push_back(meshFile.getInt());
+      meshFile.skipLine();
+
+      nNodes = eleData.size() - 1 - nTags;
+      if (nNodes < gmshNodesPerEle(eType)) {
+        cout << "Gmsh element ID " << k << ", Gmsh Element Type = " << eType << endl;
+        FatalError("Too few nodes given for element");
+      }
+    }
+
+    int bcid = bcIdMap[eleData[1]];
+    const int *nodes = &eleData[1+nTags];
 
     if (bcid == -1) {
       // NOTE: Currently, only quads are supported
@@ -1165,7 +1461,7 @@ void geo::readGmsh(string fileName)
           c2nv.push_back(4);
           c2nf.push_back(4);
           ctype.push_back(QUAD);
-          meshFile >> c2v_tmp[0] >> c2v_tmp[1] >> c2v_tmp[2];
+          std::copy_n(nodes, 3, c2v_tmp.begin());
           c2v_tmp[3] = c2v_tmp[2];
           break;
 
@@ -1174,7 +1470,9 @@ void geo::readGmsh(string fileName)
           c2nv.push_back(8);
           c2nf.push_back(4);
           ctype.push_back(QUAD);
-          meshFile >> c2v_tmp[0] >> c2v_tmp[1] >> c2v_tmp[2] >> c2v_tmp[4] >> c2v_tmp[5] >> c2v_tmp[7];
+          std::copy_n(nodes, 3, c2v_tmp.begin());
+          std::copy_n(nodes+3, 2, c2v_tmp.begin()+4);
+          c2v_tmp[7] = nodes[5];
           c2v_tmp[3] = c2v_tmp[2];
           c2v_tmp[6] = c2v_tmp[2];
           break;
@@ -1184,7 +1482,7 @@ void geo::readGmsh(string fileName)
           c2nv.push_back(4);
           c2nf.push_back(4);
           ctype.push_back(QUAD);
-          meshFile >> c2v_tmp[0] >> c2v_tmp[1] >> c2v_tmp[2] >> c2v_tmp[3];
+          std::copy_n(nodes, 4, c2v_tmp.begin());
           break;
 
         case 16:
@@ -1192,7 +1490,7 @@ void geo::readGmsh(string fileName)
           c2nv.push_back(8);
           c2nf.push_back(4);
           ctype.push_back(QUAD);
-          meshFile >> c2v_tmp[0] >> c2v_tmp[1] >> c2v_tmp[2] >> c2v_tmp[3] >> c2v_tmp[4] >> c2v_tmp[5] >> c2v_tmp[6] >> c2v_tmp[7];
+          std::copy_n(nodes, 8, c2v_tmp.begin());
           break;
 
         case 10:
@@ -1200,7 +1498,7 @@ void geo::readGmsh(string fileName)
           c2nv.push_back(9);
           c2nf.push_back(4);
           ctype.push_back(QUAD);
-          for (int i = 0; i < 9; i++) meshFile >> c2v_tmp[i];
+          std::copy_n(nodes, 9, c2v_tmp.begin());
           break;
 
         case 36:
@@ -1208,7 +1506,7 @@ void geo::readGmsh(string fileName)
           c2nv.push_back(16);
           c2nf.push_back(4);
           ctype.push_back(QUAD);
-          for (int i = 0; i < 16; i++) meshFile >> c2v_tmp[i];
+          std::copy_n(nodes, 16, c2v_tmp.begin());
           break;
 
         case 37:
@@ -1216,7 +1514,7 @@ void geo::readGmsh(string fileName)
           c2nv.push_back(25);
           c2nf.push_back(4);
           ctype.push_back(QUAD);
-          for (int i = 0; i < 25; i++) meshFile >> c2v_tmp[i];
+          std::copy_n(nodes, 25, c2v_tmp.begin());
           break;
 
         case 38:
@@ -1225,7 +1523,7 @@ void geo::readGmsh(string fileName)
           c2v_tmp.resize(36);
           c2nf.push_back(4);
           ctype.push_back(QUAD);
-          for (int i = 0; i < 36; i++) meshFile >> c2v_tmp[i];
+          std::copy_n(nodes, 36, c2v_tmp.begin());
           break;
 
         case 47:
@@ -1234,7 +1532,7 @@ void geo::readGmsh(string fileName)
           c2v_tmp.resize(49);
           c2nf.push_back(4);
           ctype.push_back(QUAD);
-          for (int i = 0; i < 49; i++) meshFile >> c2v_tmp[i];
+          std::copy_n(nodes, 49, c2v_tmp.begin());
           break;
 
         case 48:
@@ -1243,7 +1541,7 @@ void geo::readGmsh(string fileName)
           c2v_tmp.resize(64);
           c2nf.push_back(4);
           ctype.push_back(QUAD);
-          for (int i = 0; i < 64; i++) meshFile >> c2v_tmp[i];
+          std::copy_n(nodes, 64, c2v_tmp.begin());
           break;
 
         case 49:
@@ -1252,7 +1550,7 @@ void geo::readGmsh(string fileName)
           c2v_tmp.resize(81);
           c2nf.push_back(4);
           ctype.push_back(QUAD);
-          for (int i = 0; i < 81; i++) meshFile >> c2v_tmp[i];
+          std::copy_n(nodes, 81, c2v_tmp.begin());
           break;
 
         case 50:
@@ -1261,7 +1559,7 @@ void geo::readGmsh(string fileName)
           c2v_tmp.resize(100);
           c2nf.push_back(4);
           ctype.push_back(QUAD);
-          for (int i = 0; i < 100; i++) meshFile >> c2v_tmp[i];
+          std::copy_n(nodes, 100, c2v_tmp.begin());
           break;
 
         case 51:
@@ -1270,7 +1568,7 @@ void geo::readGmsh(string fileName)
           c2v_tmp.resize(121);
           c2nf.push_back(4);
           ctype.push_back(QUAD);
-          for (int i = 0; i < 121; i++) meshFile >> c2v_tmp[i];
+          std::copy_n(nodes, 121, c2v_tmp.begin());
           break;
 
         case 5:
@@ -1278,7 +1576,7 @@ void geo::readGmsh(string fileName)
           c2nv.push_back(8);
           c2nf.push_back(6);
           ctype.push_back(HEX);
-          for (int i = 0; i < 8; i++) meshFile >> c2v_tmp[i];
+          std::copy_n(nodes, 8, c2v_tmp.begin());
           break;
 
         case 17:
@@ -1287,10 +1585,12 @@ void geo::readGmsh(string fileName)
           c2nf.push_back(6);
           ctype.push_back(HEX);
           // Corner Nodes
-          meshFile >> c2v_tmp[0] >> c2v_tmp[1] >> c2v_tmp[2] >> c2v_tmp[3] >> c2v_tmp[4] >> c2v_tmp[5] >> c2v_tmp[6] >> c2v_tmp[7];
+          std::copy_n(nodes, 8, c2v_tmp.begin());
           // Edge Nodes
-          meshFile >> c2v_tmp[8] >> c2v_tmp[11] >> c2v_tmp[12] >> c2v_tmp[9] >> c2v_tmp[13] >> c2v_tmp[10];
-          meshFile >> c2v_tmp[14] >> c2v_tmp[15] >> c2v_tmp[16] >> c2v_tmp[19] >> c2v_tmp[17] >> c2v_tmp[18];
+          c2v_tmp[8]  = nodes[8];   c2v_tmp[11] = nodes[9];   c2v_tmp[12] = nodes[10];
+          c2v_tmp[9]  = nodes[11];  c2v_tmp[13] = nodes[12];  c2v_tmp[10] = nodes[13];
+          c2v_tmp[14] = nodes[14];  c2v_tmp[15] = nodes[15];  c2v_tmp[16] = nodes[16];
+          c2v_tmp[19] = nodes[17];  c2v_tmp[17] = nodes[18];  c2v_tmp[18] = nodes[19];
           break;
 
         case 12:
@@ -1299,7 +1599,7 @@ void geo::readGmsh(string fileName)
           c2nf.push_back(6);
           ctype.push_back(HEX);
           c2v_tmp.resize(27);
-          for (int i = 0; i < c2nv.back(); i++) meshFile >> c2v_tmp[i];
+          std::copy_n(nodes, c2nv.back(), c2v_tmp.begin());
           break;
 
         case 92:
@@ -1308,7 +1608,7 @@ void geo::readGmsh(string fileName)
           c2nf.push_back(6);
           ctype.push_back(HEX);
           c2v_tmp.resize(64);
-          for (int i = 0; i < c2nv.back(); i++) meshFile >> c2v_tmp[i];
+          std::copy_n(nodes, c2nv.back(), c2v_tmp.begin());
           break;
 
         case 93:
@@ -1317,7 +1617,7 @@ void geo::readGmsh(string fileName)
           c2nf.push_back(6);
           ctype.push_back(HEX);
           c2v_tmp.resize(125);
-          for (int i = 0; i < c2nv.back(); i++) meshFile >> c2v_tmp[i];
+          std::copy_n(nodes, c2nv.back(), c2v_tmp.begin());
           break;
 
         case 94:
@@ -1326,7 +1626,7 @@ void geo::readGmsh(string fileName)
           c2nf.push_back(6);
           ctype.push_back(HEX);
           c2v_tmp.resize(216);
-          for (int i = 0; i < c2nv.back(); i++) meshFile >> c2v_tmp[i];
+          std::copy_n(nodes, c2nv.back(), c2v_tmp.begin());
           break;
 
         case 4:
@@ -1334,7 +1634,8 @@ void geo::readGmsh(string fileName)
           c2nv.push_back(4);
           c2nf.push_back(4);
           ctype.push_back(HEX);
-          meshFile >> c2v_tmp[0] >> c2v_tmp[1] >> c2v_tmp[2] >> c2v_tmp[4];
+          std::copy_n(nodes, 3, c2v_tmp.begin());
+          c2v_tmp[4] = nodes[3];
           c2v_tmp[3] = 2;
           c2v_tmp[5] = c2v_tmp[4];
           c2v_tmp[6] = c2v_tmp[4];
@@ -1346,7 +1647,8 @@ void geo::readGmsh(string fileName)
           c2nv.push_back(8);
           c2nf.push_back(6);
           ctype.push_back(HEX);
-          meshFile >> c2v_tmp[0] >> c2v_tmp[1] >> c2v_tmp[2] >> c2v_tmp[4] >> c2v_tmp[5] >> c2v_tmp[6];
+          std::copy_n(nodes, 3, c2v_tmp.begin());
+          std::copy_n(nodes+3, 3, c2v_tmp.begin()+4);
           c2v_tmp[3] = c2v_tmp[2];
           c2v_tmp[7] = c2v_tmp[6];
           break;
@@ -1357,25 +1659,10 @@ void geo::readGmsh(string fileName)
           break;
       }
 
-      // Increase the size of c2v (max # of vertices per cell) if needed
-      if (c2v.getDim1()<(uint)c2nv[ic]) {
-        for (int dim=c2v.getDim1(); dim<c2nv[ic]; dim++) {
-          c2v.addCol();
-        }
-      }
-
-      // Number of nodes in c2v_tmp may vary, so use pointer rather than vector
-      c2v.insertRow(c2v_tmp.data(),-1,c2nv[ic]);
 
       // Shift every value of c2v by -1 (Gmsh is 1-indexed; we need 0-indexed)
-      for(int k=0; k<c2nv[ic]; k++) {
-        if(c2v(ic,k)!=0) {
-          c2v(ic,k)--;
-        }
-      }
-
-      ic++;
-      getline(meshFile,str); // skip end of line
+      for (int i=0; i<c2nv.back(); i++)
+        c2v_flat.push_back((c2v_tmp[i]!=0) ? c2v_tmp[i]-1 : 0);
     }
     else {
       // Boundary cell; put vertices into bndPts
@@ -1439,39 +1726,302 @@ void geo::readGmsh(string fileName)
           FatalError("Boundary Element (Face) Type Not Recognized!");
       }
 
-      for (int i=0; i<nPtsFace; i++) {
-        meshFile >> iv;  iv--;
-        boundPoints[bcid].insert(iv);
-        //bndPtsGmsh[gmshID].push_back(iv);
-      }
-      getline(meshFile,str);
+      for (int i=0; i<nPtsFace; i++)
+        boundPoints[bcid].push_back(nodes[i]-1);
     }
   } // End of loop over entities
 
-//  for (int i = 0; i < nGmshBnds; i++) {
-//    std::sort(bndPtsGmsh[i].begin(),bndPtsGmsh[i].end());
-//    bndPtsGmsh[i].erase( std::unique(bndPtsGmsh[i].begin(),bndPtsGmsh[i].end()), bndPtsGmsh[i].end() );
-//  }
+  /* --- Copy the connectivity into c2v [padded to the max. # of nodes per cell] --- */
+
+  nEles = c2nv.size();
+  int maxNv = (nEles > 0) ? *std::max_element(c2nv.begin(), c2nv.end()) : 0;
+  c2v.setup(nEles,maxNv);
+  c2v.initializeToZero();
+  int ind = 0;
+  for (int ic=0; ic<nEles; ic++) {
+    std::copy_n(&c2v_flat[ind], c2nv[ic], c2v[ic]);
+    ind += c2nv[ic];
+  }
 
   int maxNBndPts = 0;
   for (int i=0; i<nBounds; i++) {
-    nBndPts[i] = boundPoints[i].size();
+    auto &pts = boundPoints[i];
+    std::sort(pts.begin(), pts.end());
+    pts.erase(std::unique(pts.begin(), pts.end()), pts.end());
+    nBndPts[i] = pts.size();
     maxNBndPts = max(maxNBndPts,nBndPts[i]);
   }
 
   // Copy temp boundPoints data into bndPts matrix
   bndPts.setup(nBounds,maxNBndPts);
   for (int i=0; i<nBounds; i++) {
-    int j = 0;
-    for (auto& it:boundPoints[i]) {
-      bndPts(i,j) = it;
-      j++;
-    }
+    for (int j=0; j<nBndPts[i]; j++)
+      bndPts(i,j) = boundPoints[i][j];
   }
+}
 
-  nEles = c2v.getDim0();
+/* --- Helpers for the mesh cache file [see writeMeshCache] --- */
+
+static const char meshCacheMagic[8] = {'F','L','R','Y','M','E','S','H'};
+static const int meshCacheVersion = 2;
+
+template<typename T>
+static void cacheWrite(ofstream &file, const T &val)
+{
+  file.write((char*)&val, sizeof(T));
+}
+
+template<typename T>
+static void cacheWrite(ofstream &file, const vector<T> &vec)
+{
+  uint64_t n = vec.size();
+  file.write((char*)&n, sizeof(uint64_t));
+  file.write((char*)vec.data(), n*sizeof(T));
+}
+
+template<typename T>
+static void cacheWrite(ofstream &file, matrix<T> &mat)
+{
+  file.write((char*)mat.dims, 4*sizeof(uint));
+  cacheWrite(file, mat.data);
+}
+
+static void cacheWrite(ofstream &file, const vector<string> &strs)
+{
+  cacheWrite(file, (uint64_t)strs.size());
+  for (auto &str:strs)
+    cacheWrite(file, vector<char>(str.begin(),str.end()));
+}
+
+template<typename T>
+static void cacheRead(meshFileMap &file, T &val)
+{
+  file.getBinary(&val,1);
+}
+
+template<typename T>
+static void cacheRead(meshFileMap &file, vector<T> &vec)
+{
+  uint64_t n;
+  file.getBinary(&n,1);
+  vec.resize(n);
+  file.getBinary(vec.data(),n);
+}
+
+template<typename T>
+static void cacheRead(meshFileMap &file, matrix<T> &mat)
+{
+  uint dims[4];
+  file.getBinary(dims,4);
+  mat.setup(dims[0],dims[1]);
+
+  vector<T> data;
+  cacheRead(file, data);
+  if (data.size() != mat.data.size())
+    FatalError("Mesh cache file is corrupt; delete it and re-run.");
+  mat.data.swap(data);
+}
+
+static void cacheRead(meshFileMap &file, vector<string> &strs)
+{
+  uint64_t n;
+  file.getBinary(&n,1);
+  strs.resize(n);
+  for (auto &str:strs) {
+    vector<char> chars;
+    cacheRead(file, chars);
+    str.assign(chars.begin(),chars.end());
+  }
+}
+
+string geo::meshCacheName(void)
+{
+  stringstream ss;
+  ss << params->meshFileName << ".cache";
+  if (nproc > 1)
+    ss << "." << nproc << "_" << rank;
+
+  return ss.str();
+}
+
+void geo::getMeshCacheHashes(void)
+{
+  // Only rank 0 reads through the [possibly very large] mesh file
+  if (rank == 0) {
+    meshFileMap meshFile(params->meshFileName);
+    meshFileHash = meshFile.hash();
+  }
+
+#ifndef _NO_MPI
+  MPI_Bcast(&meshFileHash, 1, MPI_UINT64_T, 0, MPI_COMM_WORLD);
+#endif
+
+  // Every input which changes the pre-processed mesh
+  stringstream ss;
+  ss.precision(17);
+  ss << nproc << " " << rank << " " << sizeof(int) << " " << sizeof(uint) << " ";
+  for (auto &B:params->meshBounds)
+    ss << B.first << "=" << B.second << " ";
+  ss << params->periodicDX << " " << params->periodicDY << " " << params->periodicDZ << " " << params->periodicTol << " ";
+  ss << params->partitionType;
+
+  string opts = ss.str();
+  meshOptsHash = 14695981039346656037ULL;
+  for (auto &c:opts)
+    meshOptsHash = (meshOptsHash ^ (unsigned char)c) * 1099511628211ULL;
+}
+
+bool geo::readMeshCache(void)
+{
+  string fileName = meshCacheName();
+
+  // Collective; the hashes are kept for writeMeshCache if the cache is out of date
+  getMeshCacheHashes();
+
+  /* --- Check that the cache exists and matches the mesh file & inputs --- */
+
+  shared_ptr<meshFileMap> cacheFile;
+  bool valid = false;
+
+  struct stat st;
+  if (stat(fileName.c_str(), &st) == 0 && st.st_size >= (off_t)(8 + sizeof(int) + 2*sizeof(uint64_t))) {
+    cacheFile = make_shared<meshFileMap>(fileName);
+
+    char magic[8];
+    int version;
+    uint64_t cacheMeshHash, cacheOptsHash;
+    cacheFile->getBinary(magic,8);
+    cacheFile->getBinary(&version,1);
+    cacheFile->getBinary(&cacheMeshHash,1);
+    cacheFile->getBinary(&cacheOptsHash,1);
+
+    if (!strncmp(magic,meshCacheMagic,8) && version == meshCacheVersion)
+      valid = (meshFileHash == cacheMeshHash && meshOptsHash == cacheOptsHash);
+  }
+
+#ifndef _NO_MPI
+  // Every rank must take the same path [reading & partitioning the mesh is collective]
+  int myValid = valid, allValid;
+  MPI_Allreduce(&myValid,&allValid,1,MPI_INT,MPI_MIN,MPI_COMM_WORLD);
+  valid = allValid;
+  gridComm = MPI_COMM_WORLD;
+#endif
+
+  if (!valid) {
+    if (rank == 0) cout << "Geo: No valid mesh cache found; it will be written to " << fileName << endl;
+    return false;
+  }
 
-  meshFile.close();
+  if (rank == 0) cout << "Geo: Reading pre-processed mesh from " << fileName << endl;
+
+  /* --- Read the data in the same order as writeMeshCache --- */
+
+  meshFileMap &file = *cacheFile;
+
+  cacheRead(file,nDims);
+  cacheRead(file,nEles);      cacheRead(file,nVerts);
+  cacheRead(file,nEdges);     cacheRead(file,nFaces);
+  cacheRead(file,nIntFaces);  cacheRead(file,nBndFaces);
+  cacheRead(file,nMpiFaces);  cacheRead(file,nBounds);
+  cacheRead(file,nGmshBnds);
+
+  cacheRead(file,xv);   cacheRead(file,c2v);
+  cacheRead(file,c2nv); cacheRead(file,c2nf); cacheRead(file,ctype);
+  cacheRead(file,c2f);  cacheRead(file,c2b);  cacheRead(file,c2c);
+  cacheRead(file,f2c);  cacheRead(file,f2v);  cacheRead(file,f2nv);
+  cacheRead(file,e2v);  cacheRead(file,v2v);  cacheRead(file,v2e);
+  cacheRead(file,v2nv); cacheRead(file,v2vPtr); cacheRead(file,faceType);
+  cacheRead(file,intFaces); cacheRead(file,bndFaces);
+
+  cacheRead(file,bcList); cacheRead(file,bcNames);
+  cacheRead(file,bcType); cacheRead(file,bcID);
+  cacheRead(file,bndPts); cacheRead(file,nBndPts);
+  uint64_t nBcFaces;
+  cacheRead(file,nBcFaces);
+  bcFaces.resize(nBcFaces);
+  for (auto &bcF:bcFaces)
+    cacheRead(file,bcF);
+
+  cacheRead(file,epart);
+  cacheRead(file,ic2icg);     cacheRead(file,iv2ivg);
+  cacheRead(file,mpiFaces);   cacheRead(file,mpiCells);
+  cacheRead(file,procR);      cacheRead(file,faceID_R);
+  cacheRead(file,gIC_R);      cacheRead(file,mpiLocF);
+  cacheRead(file,mpiLocF_R);  cacheRead(file,mpiPeriodic);
+  cacheRead(file,mpiRelRot);
+
+  if (!file.atEnd())
+    FatalError("Mesh cache file is corrupt; delete it and re-run.");
+
+  params->nDims = nDims;
+  nNodesPerCell = getMax(c2nv);
+  getBoundingBox(xv,minPt,maxPt);
+
+  return true;
+}
+
+void geo::writeMeshCache(void)
+{
+#ifndef _NO_MPI
+  // Store the MPI faces' relative orientation so the global mesh isn't needed on re-load
+  if (nDims == 3 && nProcGrid > 1) {
+    mpiRelRot.resize(nMpiFaces);
+    for (int i=0; i<nMpiFaces; i++)
+      mpiRelRot[i] = compareOrientationMPI(f2c(mpiFaces[i],0),mpiLocF[i],gIC_R[i],mpiLocF_R[i],mpiPeriodic[i]);
+  }
+#endif
+
+  string fileName = meshCacheName();
+  string tmpName = fileName + ".tmp";
+
+  if (rank == 0) cout << "Geo: Writing pre-processed mesh to " << fileName << endl;
+
+  ofstream cacheFile(tmpName.c_str(), ofstream::binary);
+  if (!cacheFile.is_open()) {
+    cout << "Geo: Warning: unable to write mesh cache file " << fileName << endl;
+    return;
+  }
+
+  cacheFile.write(meshCacheMagic,8);
+  cacheWrite(cacheFile,meshCacheVersion);
+  cacheWrite(cacheFile,meshFileHash);
+  cacheWrite(cacheFile,meshOptsHash);
+
+  cacheWrite(cacheFile,nDims);
+  cacheWrite(cacheFile,nEles);      cacheWrite(cacheFile,nVerts);
+  cacheWrite(cacheFile,nEdges);     cacheWrite(cacheFile,nFaces);
+  cacheWrite(cacheFile,nIntFaces);  cacheWrite(cacheFile,nBndFaces);
+  cacheWrite(cacheFile,nMpiFaces);  cacheWrite(cacheFile,nBounds);
+  cacheWrite(cacheFile,nGmshBnds);
+
+  cacheWrite(cacheFile,xv);   cacheWrite(cacheFile,c2v);
+  cacheWrite(cacheFile,c2nv); cacheWrite(cacheFile,c2nf); cacheWrite(cacheFile,ctype);
+  cacheWrite(cacheFile,c2f);  cacheWrite(cacheFile,c2b);  cacheWrite(cacheFile,c2c);
+  cacheWrite(cacheFile,f2c);  cacheWrite(cacheFile,f2v);  cacheWrite(cacheFile,f2nv);
+  cacheWrite(cacheFile,e2v);  cacheWrite(cacheFile,v2v);  cacheWrite(cacheFile,v2e);
+  cacheWrite(cacheFile,v2nv); cacheWrite(cacheFile,v2vPtr); cacheWrite(cacheFile,faceType);
+  cacheWrite(cacheFile,intFaces); cacheWrite(cacheFile,bndFaces);
+
+  cacheWrite(cacheFile,bcList); cacheWrite(cacheFile,bcNames);
+  cacheWrite(cacheFile,bcType); cacheWrite(cacheFile,bcID);
+  cacheWrite(cacheFile,bndPts); cacheWrite(cacheFile,nBndPts);
+  cacheWrite(cacheFile,(uint64_t)bcFaces.size());
+  for (auto &bcF:bcFaces)
+    cacheWrite(cacheFile,bcF);
+
+  cacheWrite(cacheFile,epart);
+  cacheWrite(cacheFile,ic2icg);     cacheWrite(cacheFile,iv2ivg);
+  cacheWrite(cacheFile,mpiFaces);   cacheWrite(cacheFile,mpiCells);
+  cacheWrite(cacheFile,procR);      cacheWrite(cacheFile,faceID_R);
+  cacheWrite(cacheFile,gIC_R);      cacheWrite(cacheFile,mpiLocF);
+  cacheWrite(cacheFile,mpiLocF_R);  cacheWrite(cacheFile,mpiPeriodic);
+  cacheWrite(cacheFile,mpiRelRot);
+
+  cacheFile.close();
+
+  // Only replace any existing cache once the new one is complete
+  if (cacheFile.fail() || std::rename(tmpName.c_str(), fileName.c_str()))
+    cout << "Geo: Warning: unable to write mesh cache file " << fileName << endl;
 }
 
 void geo::createMesh()
@@ -2396,76 +2946,43 @@ void geo::partitionMesh(void)
 
     if (nproc <= 1) return; // No additional partitioning needed
 
-    if (rank == 0) cout << "     Partitioning mesh block " << gridID << " across " << nProcGrid << " processes" << endl;
-  }
-  else {
-    if (rank == 0) cout << "Geo: Number of elements globally: " << nEles << endl;
-    if (rank == 0) cout << "     Partitioning mesh across " << nproc << " processes" << endl;
+    /* --- The restart data of a rebalanced grid is only valid on the partition it
+     *     was written with [see writeParaview] --- */
+    if (params->restart) {
+      char fileNameC[256];
+      string fileName = params->dataFileName;
+      sprintf(fileNameC,"%s_%.09d/%s%d_%.09d.epart",&fileName[0],params->restartIter,&fileName[0],gridID,params->restartIter);
 
-    gridComm = MPI_COMM_WORLD;
-  }
+      ifstream epartFile(fileNameC, ifstream::binary);
+      if (epartFile.is_open()) {
+        int nElesFile = 0;
+        epartFile.read((char*)&nElesFile, sizeof(int));
+        vector<int> epartRestart(std::max(nElesFile,0));
+        epartFile.read((char*)epartRestart.data(), epartRestart.size()*sizeof(int));
 
-  vector<idx_t> eptr(nEles+1);
-  vector<idx_t> eind;
+        if (!epartFile || nElesFile != nEles || getMax(epartRestart) >= nProcGrid)
+          FatalError("Restart partition file does not match this grid; restart with the same number of ranks per grid.");
 
-  int nn = 0;
-  for (int i=0; i<nEles; i++) {
-    eind.push_back(c2v(i,0));
-    nn++;
-    for (int j=1; j<c2nv[i]; j++) {
-      if (c2v(i,j)==c2v(i,j-1)) {
-        continue; // To deal with collapsed edges
+        if (rank == 0) cout << "     Restarting mesh block " << gridID << " on the partition in " << fileNameC << endl;
+
+        partitionFromEpart(epartRestart);
+        return;
       }
-      eind.push_back(c2v(i,j));
-      nn++;
     }
-    eptr[i+1] = nn;
-  }
-
-  int objval;
-  epart.resize(nEles);
-  vector<int> npart(nVerts);
-
-  // int errVal = METIS PartMeshDual(idx_t *ne, idx_t *nn, idx_t *eptr, idx_t *eind, idx_t *vwgt, idx_t *vsize,
-  // idx_t *ncommon, idx_t *nparts, real_t *tpwgts, idx_t *options, idx_t *objval,idx_t *epart, idx_t *npart)
-
-  int ncommon; // 2 for 2D, ~3 for 3D [#nodes per face: 2 for quad/tri, 3 for tet, 4 for hex]
-  if (nDims == 2) ncommon = 2;
-  else if (nDims == 3) ncommon = 4;
 
-  idx_t options[METIS_NOPTIONS];
-  METIS_SetDefaultOptions(options);
-  options[METIS_OPTION_NUMBERING] = 0;
-  options[METIS_OPTION_IPTYPE] = METIS_IPTYPE_NODE;
-  options[METIS_OPTION_OBJTYPE] = METIS_OBJTYPE_CUT; // Reduces # of final MPI faces
-  options[METIS_OPTION_PTYPE] = METIS_PTYPE_KWAY;
-  options[METIS_OPTION_NCUTS] = 5;  // Allows better partitioning (less cuts) to be found [at negligible expense for CFD grids]
+    if (rank == 0) cout << "     Partitioning mesh block " << gridID << " across " << nProcGrid << " processes" << endl;
+  }
+  else {
+    if (rank == 0) cout << "Geo: Number of elements globally: " << nEles << endl;
+    if (rank == 0) cout << "     Partitioning mesh across " << nproc << " processes" << endl;
 
-  // Weight elements with boundary faces more heavily (more work to do at boundaries)
-  // TODO: adjust weight based on specific boundary type
-  int *vwgt = NULL;
-  bool useBcWeights = false; // Change to add BC-based element weighting
-  if (useBcWeights) {
-    vwgt = new int(nEles);
-    for (int ic = 0; ic < nEles; ic++) {
-      for (int ib = 0; ib < nBounds; ib++) {
-        int bcID = bcList[ib];
-        if (bcID == PERIODIC || bcID == NONE || bcID == SUP_IN || bcID == SUP_OUT) continue;
-        int wtVal = 1;
-        if (bcID == CHAR_INOUT) wtVal = 2;
-        for (int j = 0; j < c2nv[ic]; j++) {
-          int iv = c2v(ic,j);
-          if (findFirst(bndPts[ib],iv,bndPts.dims[1]) != -1) {
-            vwgt[ic] += wtVal;
-            break;
-          }
-        }
-      }
-    }
+    gridComm = MPI_COMM_WORLD;
   }
 
-  METIS_PartMeshDual(&nEles,&nVerts,eptr.data(),eind.data(),vwgt,NULL,
-                     &ncommon,&nproc,NULL,options,&objval,epart.data(),npart.data());
+  if (params->partitionType == METIS_PART)
+    partitionMetis();
+  else
+    partitionGeometric();
 
   // Copy data to the global arrays & reset local arrays
   nEles_g   = nEles;
@@ -2580,6 +3097,16 @@ void geo::getMpiPartitions(void)
     gridComm = MPI_COMM_WORLD;
   }
 
+  if (params->partitionType == METIS_PART)
+    partitionMetis();
+  else
+    partitionGeometric();
+#endif
+}
+
+void geo::partitionMetis(void)
+{
+#ifndef _NO_MPI
   vector<idx_t> eptr(nEles+1);
   vector<idx_t> eind;
 
@@ -2616,11 +3143,247 @@ void geo::getMpiPartitions(void)
   options[METIS_OPTION_PTYPE] = METIS_PTYPE_KWAY;
   options[METIS_OPTION_NCUTS] = 5;  // Allows better partitioning (less cuts) to be found [at negligible expense for CFD grids]
 
-  METIS_PartMeshDual(&nEles,&nVerts,eptr.data(),eind.data(),NULL,NULL,
+  // Weight elements with boundary faces more heavily (more work to do at boundaries)
+  // TODO: adjust weight based on specific boundary type
+  int *vwgt = NULL;
+  bool useBcWeights = false; // Change to add BC-based element weighting
+  if (useBcWeights) {
+    vwgt = new int(nEles);
+    for (int ic = 0; ic < nEles; ic++) {
+      for (int ib = 0; ib < nBounds; ib++) {
+        int bcID = bcList[ib];
+        if (bcID == PERIODIC || bcID == NONE || bcID == SUP_IN || bcID == SUP_OUT) continue;
+        int wtVal = 1;
+        if (bcID == CHAR_INOUT) wtVal = 2;
+        for (int j = 0; j < c2nv[ic]; j++) {
+          int iv = c2v(ic,j);
+          if (findFirst(bndPts[ib],iv,bndPts.dims[1]) != -1) {
+            vwgt[ic] += wtVal;
+            break;
+          }
+        }
+      }
+    }
+  }
+
+  // Caller-supplied weights [e.g. active vs. blanked cells of a moving overset grid]
+  if (!eleWeights.empty())
+    vwgt = eleWeights.data();
+
+  METIS_PartMeshDual(&nEles,&nVerts,eptr.data(),eind.data(),vwgt,NULL,
                      &ncommon,&nproc,NULL,options,&objval,epart.data(),npart.data());
 #endif
 }
 
+#ifndef _NO_MPI
+/* --- Helpers for the geometric partitioner [see partitionGeometric] --- */
+
+//! Position along the Hilbert curve of the point with integer coordinates X [Skilling, 2004]
+static uint64_t hilbertKey(uint *X, int nDims, int nBits)
+{
+  uint M = 1u << (nBits-1);
+
+  // Inverse undo
+  for (uint Q = M; Q > 1; Q >>= 1) {
+    uint P = Q - 1;
+    for (int i=0; i<nDims; i++) {
+      if (X[i] & Q) {
+        X[0] ^= P;
+      }
+      else {
+        uint t = (X[0] ^ X[i]) & P;
+        X[0] ^= t;
+        X[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  for (int i=1; i<nDims; i++)
+    X[i] ^= X[i-1];
+
+  uint t = 0;
+  for (uint Q = M; Q > 1; Q >>= 1)
+    if (X[nDims-1] & Q) t ^= Q - 1;
+
+  for (int i=0; i<nDims; i++)
+    X[i] ^= t;
+
+  // Interleave the transposed bits into a single key
+  uint64_t key = 0;
+  for (int b=nBits-1; b>=0; b--)
+    for (int i=0; i<nDims; i++)
+      key = (key << 1) | ((X[i] >> b) & 1);
+
+  return key;
+}
+
+//! Recursively bisect elements ind[i0:i1] along their longest extent into parts p0:p1
+static void bisectCoords(vector<int> &ind, int i0, int i1, int p0, int p1, const vector<double> &xc, int nDims, const vector<int> &wts, vector<int> &epart)
+{
+  if (p1 - p0 == 1) {
+    for (int i=i0; i<i1; i++)
+      epart[ind[i]] = p0;
+    return;
+  }
+
+  // Direction of largest extent
+  double xmin[3] = { INFINITY, INFINITY, INFINITY};
+  double xmax[3] = {-INFINITY,-INFINITY,-INFINITY};
+  for (int i=i0; i<i1; i++) {
+    for (int dim=0; dim<nDims; dim++) {
+      xmin[dim] = std::min(xmin[dim],xc[nDims*ind[i]+dim]);
+      xmax[dim] = std::max(xmax[dim],xc[nDims*ind[i]+dim]);
+    }
+  }
+
+  int d = 0;
+  for (int dim=1; dim<nDims; dim++)
+    if (xmax[dim]-xmin[dim] > xmax[d]-xmin[d]) d = dim;
+
+  // Split the elements [or their weight] in proportion to the # of parts on each side
+  int pm = (p0 + p1) / 2;
+  int im = i0 + (int)((long long)(i1-i0) * (pm-p0) / (p1-p0));
+
+  // Break ties by element ID so that every rank finds the same partition
+  auto compare = [&](int a, int b) {
+    double xa = xc[nDims*a+d], xb = xc[nDims*b+d];
+    return (xa < xb || (xa == xb && a < b));
+  };
+
+  if (wts.empty()) {
+    std::nth_element(ind.begin()+i0, ind.begin()+im, ind.begin()+i1, compare);
+  }
+  else {
+    std::sort(ind.begin()+i0, ind.begin()+i1, compare);
+
+    long long wTot = 0;
+    for (int i=i0; i<i1; i++)
+      wTot += wts[ind[i]];
+
+    long long wTarget = wTot * (pm-p0) / (p1-p0);
+    long long wSum = 0;
+    im = i0;
+    while (im < i1 && wSum + wts[ind[im]] <= wTarget) {
+      wSum += wts[ind[im]];
+      im++;
+    }
+  }
+
+#pragma omp task shared(ind,xc,wts,epart) if (im-i0 > 10000)
+  bisectCoords(ind,i0,im,p0,pm,xc,nDims,wts,epart);
+
+  bisectCoords(ind,im,i1,pm,p1,xc,nDims,wts,epart);
+
+#pragma omp taskwait
+}
+#endif
+
+void geo::partitionGeometric(void)
+{
+#ifndef _NO_MPI
+  if (rank == 0) {
+    if (params->partitionType == RCB_PART)
+      cout << "Geo:   Using recursive coordinate bisection" << endl;
+    else
+      cout << "Geo:   Using Hilbert-curve ordering" << endl;
+  }
+
+  /* --- Every rank holds the global mesh, so each finds all of the centroids
+   *     [and the partition] itself, with no communication --- */
+
+  vector<double> xc(nDims*nEles, 0.);
+
+#pragma omp parallel for
+  for (int ic=0; ic<nEles; ic++) {
+    for (int j=0; j<c2nv[ic]; j++)
+      for (int dim=0; dim<nDims; dim++)
+        xc[nDims*ic+dim] += xv(c2v(ic,j),dim);
+
+    for (int dim=0; dim<nDims; dim++)
+      xc[nDims*ic+dim] /= c2nv[ic];
+  }
+
+  epart.resize(nEles);
+
+  if (params->partitionType == RCB_PART) {
+    /* --- Bisect the centroids identically on every rank --- */
+
+    vector<int> ind(nEles);
+    for (int ic=0; ic<nEles; ic++)
+      ind[ic] = ic;
+
+#pragma omp parallel
+#pragma omp single
+    bisectCoords(ind,0,nEles,0,nproc,xc,nDims,eleWeights,epart);
+  }
+  else {
+    /* --- Map the centroids onto a Hilbert curve, then cut it into equal pieces --- */
+
+    double xmin[3], xmax[3];
+    for (int dim=0; dim<nDims; dim++) {
+      xmin[dim] =  INFINITY;
+      xmax[dim] = -INFINITY;
+    }
+
+    for (int ic=0; ic<nEles; ic++) {
+      for (int dim=0; dim<nDims; dim++) {
+        xmin[dim] = std::min(xmin[dim],xc[nDims*ic+dim]);
+        xmax[dim] = std::max(xmax[dim],xc[nDims*ic+dim]);
+      }
+    }
+
+    // Keys must fit in 64 bits
+    int nBits = (nDims == 2) ? 31 : 21;
+    double maxX = (double)((1u << nBits) - 1);
+
+    vector<uint64_t> keys(nEles);
+
+#pragma omp parallel for
+    for (int ic=0; ic<nEles; ic++) {
+      uint X[3];
+      for (int dim=0; dim<nDims; dim++) {
+        double dx = xmax[dim] - xmin[dim];
+        double s = (dx > 0) ? (xc[nDims*ic+dim] - xmin[dim]) / dx : 0.;
+        X[dim] = (uint)std::min(std::max(s*maxX,0.),maxX);
+      }
+      keys[ic] = hilbertKey(X,nDims,nBits);
+    }
+
+    vector<int> ind(nEles);
+    for (int ic=0; ic<nEles; ic++)
+      ind[ic] = ic;
+
+    std::sort(ind.begin(), ind.end(), [&](int a, int b) {
+      return (keys[a] < keys[b] || (keys[a] == keys[b] && a < b));
+    });
+
+    if (eleWeights.empty()) {
+      for (int p=0; p<nproc; p++) {
+        int i0 = (long long)nEles*p/nproc;
+        int i1 = (long long)nEles*(p+1)/nproc;
+        for (int i=i0; i<i1; i++)
+          epart[ind[i]] = p;
+      }
+    }
+    else {
+      // Cut the curve where the running weight crosses each part's share
+      long long wTot = 0;
+      for (auto &w:eleWeights)
+        wTot += w;
+
+      long long wSum = 0;
+      for (int i=0; i<nEles; i++) {
+        int ic = ind[i];
+        int p = (int)((2*wSum + eleWeights[ic]) * nproc / (2*wTot));
+        epart[ic] = std::min(p,nproc-1);
+        wSum += eleWeights[ic];
+      }
+    }
+  }
+#endif
+}
+
 void geo::partitionFromEpart(const vector<int>& _epart)
 {
 #ifndef _NO_MPI
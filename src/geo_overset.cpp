@@ -49,47 +49,85 @@
 #include "metis.h"
 #endif
 
+/* --- Relative costs used by the processor-allocation model in splitGridProcs,
+ * per residual & per donor solution point [in units of the work at one
+ * solution point of the flow solution itself] --- */
+
+//! Interpolating the solution [& gradient] to one receptor point
+#define COST_DONOR_INTERP 0.05
+//! Re-finding the donor of one receptor point on moving grids [Newton iterations]
+#define COST_DONOR_SEARCH 0.2
+//! Updating the metrics of a moving grid, per solution point
+#define COST_GRID_MOTION 0.5
+
+/* --- Partitioning weights used when rebalancing a moving grid [setupRebalance]:
+ * blanked cells only see the grid motion & hole cutting --- */
+
+#define ACTIVE_CELL_WEIGHT 10
+#define HOLE_CELL_WEIGHT 1
+
 void geo::splitGridProcs(void)
 {
 #ifndef _NO_MPI
   // Split the processes among the overset grids such that they are roughly balanced
 
-  /* --- Read Number of Elements in Each Grid --- */
+  vector<int> nProcsGrid = params->gridProcs;
 
-  vector<int> nElesGrid(nGrids);
-  int nElesTotal = 0;
+  if (getSum(nProcsGrid) == 0) {
+    /* --- Estimate each grid's cost per residual, in units of the work at one
+     * solution point, from its # of cells & overset-boundary faces --- */
 
-  for (int i=0; i<nGrids; i++) {
-    ifstream meshFile;
-    string str;
-    string fileName = params->oversetGrids[i];
+    vector<double> gridCost(nGrids);
 
-    meshFile.open(fileName.c_str());
-    if (!meshFile.is_open())
-      FatalError("Unable to open mesh file.");
+    if (rank == 0) {
+      int nSpts = pow(params->order+1,params->nDims);
+      int nFpts = pow(params->order+1,params->nDims-1);
+      double sptCost = (params->viscous) ? 2 : 1;
 
-    // Move cursor to $Elements
-    meshFile.clear();
-    meshFile.seekg(0, ios::beg);
-    while(1) {
-      getline(meshFile,str);
-      if (str.find("$Elements")!=string::npos) break;
-      if(meshFile.eof()) FatalError("$Elements tag not found in Gmsh file!");
+      vector<int> nCellsGrid(nGrids), nOverGrid(nGrids);
+      int nCellsTotal = 0;
+      for (int i=0; i<nGrids; i++) {
+        countGmshCells(params->oversetGrids[i],nCellsGrid[i],nOverGrid[i]);
+        nCellsTotal += nCellsGrid[i];
+      }
+
+      for (int i=0; i<nGrids; i++) {
+        double cost = (double)nCellsGrid[i]*nSpts*sptCost;
+
+        // Motion types 3-5 only move grid 0
+        bool moving = (params->motion && (params->motion < 3 || i == 0));
+        if (moving)
+          cost += COST_GRID_MOTION*nCellsGrid[i]*nSpts;
+
+        // The donors for this grid's receptor points lie on the other grids;
+        // split their interpolation [& search, for moving grids] by cell count
+        double donorCost = (double)nOverGrid[i]*nFpts*nSpts*COST_DONOR_INTERP*sptCost;
+        if (params->motion)
+          donorCost += (double)nOverGrid[i]*nFpts*nSpts*COST_DONOR_SEARCH;
+
+        int nCellsOther = nCellsTotal - nCellsGrid[i];
+        for (int j=0; j<nGrids; j++) {
+          if (j == i) continue;
+          if (nCellsOther > 0)
+            gridCost[j] += donorCost*nCellsGrid[j]/nCellsOther;
+        }
+
+        gridCost[i] += cost;
+      }
     }
 
-    // Read total number of interior + boundary elements
-    meshFile >> nElesGrid[i];
-    meshFile.close();
+    MPI_Bcast(gridCost.data(),nGrids,MPI_DOUBLE,0,MPI_COMM_WORLD);
 
-    nElesTotal += nElesGrid[i];
+    nProcsGrid = splitProcsByCost(gridCost,nproc);
+  }
+  else if (nProcsGrid.size() != nGrids || getSum(nProcsGrid) != nproc || getMin(nProcsGrid) < 1) {
+    FatalError("gridProcs must give at least 1 rank to each overset grid, and sum to the total # of ranks.");
   }
 
-  /* --- Balance the processes across the grids --- */
-
-  vector<int> nProcsGrid(nGrids);
-  for (int i=0; i<nGrids; i++) {
-    double eleRatio = (double)nElesGrid[i]/nElesTotal;
-    nProcsGrid[i] = round(eleRatio*nproc);
+  if (rank == 0) {
+    cout << "Geo: MPI ranks per overset grid:";
+    for (auto &np:nProcsGrid) cout << " " << np;
+    cout << endl;
   }
 
   /* --- Get the final gridID for this rank --- */
@@ -114,6 +152,140 @@ void geo::splitGridProcs(void)
 #endif
 }
 
+void geo::setupRebalance(geo &old, bool repartition)
+{
+#ifndef _NO_MPI
+  params = old.params;
+
+  nDims = old.nDims;
+  nFields = old.nFields;
+  meshType = old.meshType;
+  nGrids = old.nGrids;
+  gridID = old.gridID;
+  gridRank = old.gridRank;
+  nProcGrid = old.nProcGrid;
+  gridIdList = old.gridIdList;
+  rank = gridRank;
+  nproc = nProcGrid;
+
+  nBounds = old.nBounds;
+  nGmshBnds = old.nGmshBnds;
+  bcList = old.bcList;
+  bcNames = old.bcNames;
+  bcIdMap = old.bcIdMap;
+
+  MPI_Comm_split(MPI_COMM_WORLD, gridID, params->rank, &gridComm);
+
+  /* --- Restore the global grid, at the current vertex positions --- */
+
+  matrix<double> xvInit; // Initial [global] vertex positions, for the grid motion
+  vector<int> iblankCell_g(old.iblankCell);
+
+  if (old.nProcGrid > 1) {
+    nEles   = old.nEles_g;
+    nVerts  = old.nVerts_g;
+    c2v     = old.c2v_g;
+    ctype   = old.ctype_g;
+    c2nv    = old.c2nv_g;
+    c2nf    = old.c2ne_g;
+    bndPts  = old.bndPts_g;
+    nBndPts = old.nBndPts_g;
+    xvInit  = old.xv_g;
+
+    // Each vertex is current on every rank which holds it
+    xv.setup(nVerts,nDims);
+    xv.initializeToValue(-INFINITY);
+    for (int iv=0; iv<old.nVerts; iv++)
+      for (int dim=0; dim<nDims; dim++)
+        xv(old.iv2ivg[iv],dim) = old.xv(iv,dim);
+
+    MPI_Allreduce(MPI_IN_PLACE,xv.getData(),xv.getSize(),MPI_DOUBLE,MPI_MAX,gridComm);
+
+    iblankCell_g.assign(nEles,0);
+    for (int ic=0; ic<old.nEles; ic++)
+      iblankCell_g[old.ic2icg[ic]] = old.iblankCell[ic];
+
+    MPI_Allreduce(MPI_IN_PLACE,iblankCell_g.data(),nEles,MPI_INT,MPI_SUM,gridComm);
+  }
+  else {
+    nEles   = old.nEles;
+    nVerts  = old.nVerts;
+    c2v     = old.c2v;
+    ctype   = old.ctype;
+    c2nv    = old.c2nv;
+    c2nf    = old.c2nf;
+    bndPts  = old.bndPts;
+    nBndPts = old.nBndPts;
+    xv      = old.xv;
+
+    xvInit.setup(nVerts,nDims);
+    for (int iv=0; iv<nVerts; iv++)
+      for (int dim=0; dim<nDims; dim++)
+        xvInit(iv,dim) = old.xv0[iv][dim];
+  }
+
+  nNodesPerCell = getMax(c2nv);
+
+  /* --- Re-cut the grid, weighting the cells by their current blanking --- */
+
+  if (repartition) {
+    if (gridRank == 0)
+      cout << "Geo: Repartitioning grid " << gridID << " across " << nProcGrid << " processes" << endl;
+
+    eleWeights.resize(nEles);
+    for (int ic=0; ic<nEles; ic++)
+      eleWeights[ic] = (iblankCell_g[ic] == HOLE) ? HOLE_CELL_WEIGHT : ACTIVE_CELL_WEIGHT;
+
+    if (params->partitionType == METIS_PART)
+      partitionMetis();
+    else
+      partitionGeometric();
+
+    eleWeights.clear();
+  }
+  else {
+    epart = old.epart;
+  }
+
+  partitionFromEpart(epart);
+
+  // Hole cutting & overset connectivity at the current positions
+  processConnectivity();
+
+  /* --- The grid motion is given relative to the initial positions --- */
+
+  if (nProcGrid > 1)
+    xv_g = xvInit;
+
+  for (int iv=0; iv<nVerts; iv++) {
+    int ivg = (nProcGrid > 1) ? iv2ivg[iv] : iv;
+    for (int dim=0; dim<nDims; dim++)
+      xv(iv,dim) = xvInit(ivg,dim);
+  }
+
+  setupMeshMotion();
+
+  // The ADT must be built in the initial frame, as updateADT may only offset it
+  if (nDims == 2) {
+    calcEleBBox();
+    adt->refitADT();
+  }
+
+  moveMesh(0.);
+
+  if (nDims == 2)
+    updateADT();
+
+  holeCells.clear();
+  for (int ic=0; ic<nEles; ic++)
+    if (iblankCell[ic] == HOLE)
+      holeCells.insert(ic);
+#else
+  (void)old;
+  (void)repartition;
+#endif
+}
+
 void geo::setupOverset3D(void)
 {
 #ifndef _NO_MPI
@@ -202,13 +374,7 @@ void geo::setupOverset2D(void)
   OComm->setIblanks2D(xv,overFaceNodes,wallFaceNodes,iblank);
 
   eleBBox.setup(nEles,nDims*2);
-  for (int i=0; i<nEles; i++) {
-    matrix<double> epts;
-    for (int j=0; j<c2nv[i]; j++) {
-      epts.insertRow(xv[c2v(i,j)],INSERT_AT_END,nDims);
-    }
-    getBoundingBox(epts.getData(),c2nv[i],nDims,eleBBox[i]);
-  }
+  calcEleBBox();
 
   adt = make_shared<ADT>();
   OComm->adt = adt;
@@ -307,18 +473,41 @@ void geo::updateADT(void)
     // Have TIOGA perform the nodal overset connectivity (set nodal iblanks)
     tg->performConnectivity();
   } else {
-    for (int i=0; i<nEles; i++) {
-      matrix<double> epts;
-      for (int j=0; j<c2nv[i]; j++) {
-        epts.insertRow(xv[c2v(i,j)],INSERT_AT_END,nDims);
-      }
-      getBoundingBox(epts.getData(),c2nv[i],nDims,eleBBox[i]);
+    if (isRigidMotion(params,gridID)) {
+      // Rigid translation [or no motion] of this grid: the element boxes & tree
+      // are unchanged in the grid's own frame, so just shift the search boxes
+      point offset;
+      if (nVerts > 0)
+        offset = point(xv[0],nDims) - xv0[0];
+      double dx[3] = {offset.x, offset.y, offset.z};
+      adt->setOffset(dx);
+    } else {
+      calcEleBBox();
+      adt->refitADT();
     }
-    adt->buildADT(nDims*2,nEles,eleBBox.getData());
   }
 #endif
 }
 
+void geo::calcEleBBox(void)
+{
+#pragma omp parallel for
+  for (int i=0; i<nEles; i++) {
+    double *box = eleBBox[i];
+    for (int dim=0; dim<nDims; dim++) {
+      box[dim]       =  INFINITY;
+      box[nDims+dim] = -INFINITY;
+    }
+    for (int j=0; j<c2nv[i]; j++) {
+      double *pt = xv[c2v(i,j)];
+      for (int dim=0; dim<nDims; dim++) {
+        box[dim]       = min(box[dim],pt[dim]);
+        box[nDims+dim] = max(box[nDims+dim],pt[dim]);
+      }
+    }
+  }
+}
+
 void geo::setIterIblanks(void)
 {
 #ifndef _NO_MPI
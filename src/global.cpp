@@ -212,43 +212,51 @@ void simTimer::showTime(int precision)
 }
 
 #ifdef _OMP
-void omp_blocked_dgemm(CBLAS_ORDER mode, CBLAS_TRANSPOSE transA,
-    CBLAS_TRANSPOSE transB, int M, int N, int K, double alpha, double* A, int lda,
-    double* B, int ldb, double beta, double* C, int ldc)
+static void cblas_gemm(CBLAS_ORDER mode, CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB,
+    int M, int N, int K, double alpha, double* A, int lda, double* B, int ldb,
+    double beta, double* C, int ldc)
 {
-  if (mode == CblasRowMajor)
-  {
-#pragma omp parallel
-    {
-      int nThreads = omp_get_num_threads();
-      int thread_idx = omp_get_thread_num();
-
-      int block_size = N / nThreads;
-      int start_idx = block_size * thread_idx;
+  cblas_dgemm(mode, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
 
-      if (thread_idx == nThreads-1)
-        block_size += N % (block_size);
+static void cblas_gemm(CBLAS_ORDER mode, CBLAS_TRANSPOSE transA, CBLAS_TRANSPOSE transB,
+    int M, int N, int K, float alpha, float* A, int lda, float* B, int ldb,
+    float beta, float* C, int ldc)
+{
+  cblas_sgemm(mode, transA, transB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc);
+}
 
-      cblas_dgemm(mode, transA, transB, M, block_size, K, alpha, A, lda,
-                  B + start_idx, ldb, beta, C + start_idx, ldc);
-    }
-  }
-  else
-  {
+template<typename T>
+void omp_blocked_gemm(CBLAS_ORDER mode, CBLAS_TRANSPOSE transA,
+    CBLAS_TRANSPOSE transB, int M, int N, int K, double alpha, T* A, int lda,
+    T* B, int ldb, double beta, T* C, int ldc)
+{
 #pragma omp parallel
-    {
-      int nThreads = omp_get_num_threads();
-      int thread_idx = omp_get_thread_num();
-
-      int block_size = N / nThreads;
-      int start_idx = block_size * thread_idx;
-
-      if (thread_idx == nThreads-1)
-        block_size += N % (block_size);
-
-      cblas_dgemm(mode, transA, transB, M, block_size, K, alpha, A, lda,
-          B + ldb * start_idx, ldb, beta, C + ldc * start_idx, ldc);
+  {
+    int nThreads = omp_get_num_threads();
+    int thread_idx = omp_get_thread_num();
+
+    // Split the N columns [rows, if column-major] as evenly as possible;
+    // threads left without any [N < nThreads] sit this one out
+    int start_idx = (long long)N * thread_idx / nThreads;
+    int block_size = (long long)N * (thread_idx+1) / nThreads - start_idx;
+
+    if (block_size > 0) {
+      if (mode == CblasRowMajor)
+        cblas_gemm(mode, transA, transB, M, block_size, K, (T)alpha, A, lda,
+                   B + start_idx, ldb, (T)beta, C + start_idx, ldc);
+      else
+        cblas_gemm(mode, transA, transB, M, block_size, K, (T)alpha, A, lda,
+                   B + ldb * start_idx, ldb, (T)beta, C + ldc * start_idx, ldc);
     }
   }
 }
+
+template void omp_blocked_gemm(CBLAS_ORDER mode, CBLAS_TRANSPOSE transA,
+    CBLAS_TRANSPOSE transB, int M, int N, int K, double alpha, double* A, int lda,
+    double* B, int ldb, double beta, double* C, int ldc);
+
+template void omp_blocked_gemm(CBLAS_ORDER mode, CBLAS_TRANSPOSE transA,
+    CBLAS_TRANSPOSE transB, int M, int N, int K, double alpha, float* A, int lda,
+    float* B, int ldb, double beta, float* C, int ldc);
 #endif
@@ -199,6 +199,55 @@ void fileReader::getMap(string optName, map<T,U> &opt) {
   closeFile();
 }
 
+template<typename T>
+void fileReader::getVectorValue(string optName, vector<T> &opt, T defaultVal)
+{
+  string str, optKey;
+
+  openFile();
+
+  if (!optFile.is_open()) {
+    optFile.open(fileName.c_str());
+    if (!optFile.is_open())
+      FatalError("Cannont open input file for reading.");
+  }
+
+  // Rewind to the start of the file
+  optFile.seekg(0,optFile.beg);
+
+  // Search for the given option string
+  while (getline(optFile,str)) {
+    // Remove any leading whitespace & see if first word is the input option
+    stringstream ss;
+    ss.str(str);
+    ss >> optKey;
+    if (optKey.compare(optName)==0) {
+      int nVals;
+      if (!(ss >> nVals)) {
+        cout << "WARNING: Unable to read number of entries for vector option " << optName << endl;
+        cout << "Using default value of " << defaultVal << " instead." << endl;
+        break;
+      }
+
+      opt.resize(nVals);
+      for (int i=0; i<nVals; i++) {
+        if (!(ss >> opt[i])) {
+          cout << "WARNING: Unable to assign all values to vector option " << optName << endl;
+          cout << "Using default value of " << defaultVal << " instead." << endl;
+          std::fill(opt.begin(), opt.end(), defaultVal);
+          break;
+        }
+      }
+
+      closeFile();
+      return;
+    }
+  }
+
+  std::fill(opt.begin(), opt.end(), defaultVal);
+  closeFile();
+}
+
 template<typename T>
 void fileReader::getVectorValue(string optName, vector<T> &opt)
 {
@@ -388,6 +437,7 @@ void input::readInputFile(char *filename)
     // Reading in the mesh in one form or another
     if (meshType == READ_MESH) {
       opts.getScalarValue("meshFileName",meshFileName);
+      opts.getScalarValue("meshCache",meshCache,0);
     }
     else if (meshType == OVERSET_MESH) {
       opts.getVectorValue("oversetGrids",oversetGrids);
@@ -395,6 +445,10 @@ void input::readInputFile(char *filename)
       opts.getScalarValue("oversetMethod",oversetMethod);
       opts.getScalarValue("projection",projection,1);
       nGrids = oversetGrids.size();
+      gridProcs.resize(nGrids);
+      opts.getVectorValue("gridProcs",gridProcs,0);
+      opts.getScalarValue("rebalanceFreq",rebalanceFreq,0);
+      opts.getScalarValue("rebalanceTol",rebalanceTol,1.2);
     }
 
     // Get mesh boundaries, boundary conditions & convert to lowercase
@@ -409,6 +463,10 @@ void input::readInputFile(char *filename)
     }
   }
 
+  opts.getScalarValue("partitionType",partitionType,(int)METIS_PART);
+  if (partitionType < METIS_PART || partitionType > HILBERT_PART)
+    FatalError("Unknown partitionType [0: METIS, 1: RCB, 2: Hilbert curve].");
+
   opts.getScalarValue("periodicDX",periodicDX,(double)INFINITY);
   opts.getScalarValue("periodicDY",periodicDY,(double)INFINITY);
   opts.getScalarValue("periodicDZ",periodicDZ,(double)INFINITY);
@@ -427,8 +485,51 @@ void input::readInputFile(char *filename)
   opts.getScalarValue("resType",resType,2);
   opts.getScalarValue("plotFreq",plotFreq,100);
   opts.getScalarValue("plotType",plotType,1);
+  if (plotType == 2) {
+    opts.getScalarValue("modalOrder",modalOrder,-1);
+    opts.getScalarValue("modalTol",modalTol,0.);
+  }
   opts.getScalarValue("plotSurfaces",plotSurfaces,0);
   opts.getScalarValue("plotPolarCoords",plotPolarCoords,1);
+  opts.getScalarValue("asyncOutput",asyncOutput,1);
+  opts.getScalarValue("nPlotFiles",nPlotFiles,0);
+  opts.getScalarValue("probeFile",probeFile,string(""));
+  opts.getScalarValue("probeFreq",probeFreq,1);
+  opts.getScalarValue("calcStats",calcStats,0);
+  if (calcStats) {
+    opts.getScalarValue("statsStartIter",statsStartIter,0);
+    opts.getScalarValue("statsFreq",statsFreq,1);
+  }
+
+  int nPlotRegions;
+  opts.getScalarValue("nPlotRegions",nPlotRegions,0);
+  plotRegions.resize(nPlotRegions);
+  for (int i=0; i<nPlotRegions; i++) {
+    auto &R = plotRegions[i];
+    string reg = "plotRegion" + std::to_string(i) + "_";
+    opts.getScalarValue(reg+"xmin",R.xmin,-(double)INFINITY);
+    opts.getScalarValue(reg+"xmax",R.xmax,(double)INFINITY);
+    opts.getScalarValue(reg+"ymin",R.ymin,-(double)INFINITY);
+    opts.getScalarValue(reg+"ymax",R.ymax,(double)INFINITY);
+    opts.getScalarValue(reg+"zmin",R.zmin,-(double)INFINITY);
+    opts.getScalarValue(reg+"zmax",R.zmax,(double)INFINITY);
+    opts.getScalarValue(reg+"wallDist",R.wallDist,-1.);
+    opts.getScalarValue(reg+"freq",R.freq,plotFreq);
+    opts.getScalarValue(reg+"res",R.res,0);
+    if (R.freq <= 0)
+      FatalError("plotRegion freq must be positive [set plotRegion<i>_freq or plotFreq].");
+    if (R.res != 0 && (R.res < 2 || R.res > order+3))
+      FatalError("plotRegion res must be between 2 and order+3 [or 0 for all plot points].");
+  }
+  if (plotType != 1 && nPlotRegions > 0) {
+    if (rank == 0) cout << "WARNING: Plot regions only supported for ParaView output [plotType 1]; ignoring." << endl;
+    plotRegions.clear();
+  }
+
+  if (meshType == OVERSET_MESH && nPlotFiles > 0) {
+    if (rank == 0) cout << "WARNING: nPlotFiles not supported for overset meshes; using one file per rank." << endl;
+    nPlotFiles = 0;
+  }
   opts.getScalarValue("restart_freq",restart_freq,100);
   opts.getScalarValue("dataFileName",dataFileName,string("simData"));
 
@@ -456,6 +557,12 @@ void input::readInputFile(char *filename)
     opts.getScalarValue("shapeOrder",shapeOrder,2);
   }
 
+  /* --- Performance Tuning --- */
+  opts.getScalarValue("autotune",autotune,0);
+  if (autotune)
+    opts.getScalarValue("autotuneFile",autotuneFile,string("flurry_autotune.dat"));
+  opts.getScalarValue("residualTasks",residualTasks,0);
+
   /* --- Cleanup ---- */
   opts.closeFile();
 
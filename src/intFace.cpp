@@ -109,6 +109,8 @@ void intFace::getPointersRight(void)
       for (int k = 0; k < nFields; k++)
         dUcR(i,k) = &(eR->dUc_fpts(fptR[i],k));
   }
+
+  waveSpFaceR = (params->dtType != 0) ? &(eR->waveSp_faces(faceID_R)) : NULL;
 }
 
 void intFace::getRightState(void)
@@ -150,7 +152,14 @@ void intFace::setRightStateFlux(void)
     for (int j=0; j<nFields; j++)
       FnR[i][j] = -Fn(i,j)*dAR[i]; // opposite normal direction
 
-
+  // Wave speed is common to both sides [quadrature weights are symmetric
+  // under the L/R flux-point reordering]
+  if (params->dtType != 0) {
+    double waveSpFace = 0;
+    for (int i=0; i<nFptsR; i++)
+      waveSpFace += (*waveSp[i]) * wtsFace[i] * dAR[i];
+    *waveSpFaceR = waveSpFace;
+  }
 }
 
 void intFace::setRightStateSolution(void)
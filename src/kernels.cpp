@@ -0,0 +1,421 @@
+/*!
+ * \file kernels.cpp
+ * \brief Operator-application kernels & startup autotuner
+ *
+ * \author - Jacob Crabill
+ *           Aerospace Computing Laboratory (ACL)
+ *           Aero/Astro Department. Stanford University
+ *
+ * \version 1.0.0
+ *
+ * Flux Reconstruction in C++ (Flurry++) Code
+ * Copyright (C) 2015 Jacob Crabill
+ *
+ * Flurry++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Flurry++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with Flurry++; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ */
+
+#include "kernels.hpp"
+
+#include <array>
+#include <chrono>
+#include <sstream>
+#include <unistd.h>
+
+#ifndef _NO_MPI
+#include "mpi.h"
+#endif
+
+#ifdef _OMP
+#include <omp.h>
+#endif
+
+#ifdef _MKL_BLAS
+#include "mkl_cblas.h"
+#else
+#include "cblas.h"
+#endif
+
+//! Number of timed repetitions of each candidate backend (after one warm-up)
+#define N_TUNE_REPS 4
+
+//! Column-block size for the sparse kernel [doubles]
+#define SPARSE_BLOCK 512
+
+/* ---- Fixed-size element kernels ----
+ * For each element type & order, instantiate the spts->fpts, spts->mpts,
+ * gradient [nSpts x nSpts] and single-point interpolation [1 x nSpts] shapes
+ * for a scalar field and for the Navier-Stokes fields.  P = order + 1. */
+
+#define SMALL_GEMM(M,K,N) {{{M,K,N}}, &smallGemm<M,K,N>}
+
+#define QUAD_KERNELS(P,N) \
+  SMALL_GEMM(4*P,P*P,N), SMALL_GEMM(4,P*P,N), SMALL_GEMM(P*P,P*P,N), SMALL_GEMM(1,P*P,N)
+
+#define HEX_KERNELS(P,N) \
+  SMALL_GEMM(6*P*P,P*P*P,N), SMALL_GEMM(8+12*P,P*P*P,N), SMALL_GEMM(P*P*P,P*P*P,N), SMALL_GEMM(1,P*P*P,N)
+
+static const map<array<int,3>,smallGemmFn> smallGemmTable = {
+  QUAD_KERNELS(2,1), QUAD_KERNELS(3,1), QUAD_KERNELS(4,1), QUAD_KERNELS(5,1),
+  QUAD_KERNELS(2,4), QUAD_KERNELS(3,4), QUAD_KERNELS(4,4), QUAD_KERNELS(5,4),
+  HEX_KERNELS(2,1),  HEX_KERNELS(3,1),  HEX_KERNELS(4,1),
+  HEX_KERNELS(2,5),  HEX_KERNELS(3,5),  HEX_KERNELS(4,5)
+};
+
+smallGemmFn getSmallGemm(int m, int k, int n)
+{
+  auto it = smallGemmTable.find({{m,k,n}});
+  if (it == smallGemmTable.end())
+    return NULL;
+
+  return it->second;
+}
+
+void smallGemmGeneric(int m, int k, int n, const double* A, const double* B, double* C)
+{
+  for (int i = 0; i < m; i++) {
+    for (int j = 0; j < n; j++)
+      C[i*n+j] = 0.;
+
+    for (int p = 0; p < k; p++) {
+      double a = A[i*k+p];
+      for (int j = 0; j < n; j++)
+        C[i*n+j] += a * B[p*n+j];
+    }
+  }
+}
+
+void oppKernel::setup(const matrix<double> &_A, const string &_name)
+{
+  A = _A;
+  name = _name;
+  m = A.getDim0();
+  k = A.getDim1();
+
+#ifdef _OMP
+  backend = OPP_BLAS_OMP;
+#else
+  backend = OPP_BLAS;
+#endif
+
+  /* --- Compressed-row storage; tensor-product operators such as
+   * opp_spts_to_fpts have only (order+1) non-zeros per row --- */
+
+  rowPtr.assign(m+1,0);
+  colInd.resize(0);
+  vals.resize(0);
+  for (int i = 0; i < m; i++) {
+    for (int j = 0; j < k; j++) {
+      if (A(i,j) != 0) {
+        colInd.push_back(j);
+        vals.push_back(A(i,j));
+      }
+    }
+    rowPtr[i+1] = colInd.size();
+  }
+
+  /* --- Single-precision copies --- */
+
+  Af.assign(A.getData(), A.getData()+m*k);
+  valsf.assign(vals.begin(), vals.end());
+
+  /* --- Fixed-size element kernels --- */
+
+  eleFns[0] = NULL;
+  for (int n = 1; n <= MAX_SMALL_N; n++)
+    eleFns[n] = getSmallGemm(m, k, n);
+}
+
+void oppKernel::apply(int n, double *B, double *C, double beta)
+{
+  apply(n, B, C, beta, backend);
+}
+
+void oppKernel::apply(int n, double *B, double *C, double beta, int _backend)
+{
+  switch (_backend) {
+    case OPP_BLAS:
+      cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+                  1.0, A.getData(), k, B, n, beta, C, n);
+      break;
+
+    case OPP_BLAS_OMP:
+#ifdef _OMP
+      omp_blocked_gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+                        1.0, A.getData(), k, B, n, beta, C, n);
+#else
+      cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+                  1.0, A.getData(), k, B, n, beta, C, n);
+#endif
+      break;
+
+    case OPP_SPARSE:
+      applySparse(n, n, vals.data(), B, C, beta);
+      break;
+
+    default:
+      FatalError("Unknown operator backend.");
+  }
+}
+
+void oppKernel::apply(int n, float *B, float *C, double beta)
+{
+  apply(n, B, C, beta, backend);
+}
+
+void oppKernel::apply(int n, float *B, float *C, double beta, int _backend)
+{
+  switch (_backend) {
+    case OPP_BLAS:
+      cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+                  1.0f, Af.data(), k, B, n, (float)beta, C, n);
+      break;
+
+    case OPP_BLAS_OMP:
+#ifdef _OMP
+      omp_blocked_gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+                        1.0f, Af.data(), k, B, n, (float)beta, C, n);
+#else
+      cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+                  1.0f, Af.data(), k, B, n, (float)beta, C, n);
+#endif
+      break;
+
+    case OPP_SPARSE:
+      applySparse(n, n, valsf.data(), B, C, beta);
+      break;
+
+    default:
+      FatalError("Unknown operator backend.");
+  }
+}
+
+void oppKernel::applyCols(int n, int ld, double *B, double *C, double beta)
+{
+  if (backend == OPP_SPARSE)
+    applySparse(n, ld, vals.data(), B, C, beta);
+  else
+    cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+                1.0, A.getData(), k, B, ld, beta, C, ld);
+}
+
+void oppKernel::applyCols(int n, int ld, float *B, float *C, double beta)
+{
+  if (backend == OPP_SPARSE)
+    applySparse(n, ld, valsf.data(), B, C, beta);
+  else
+    cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+                1.0f, Af.data(), k, B, ld, (float)beta, C, ld);
+}
+
+void oppKernel::applyEle(int n, const double *B, double *C)
+{
+  if (n <= MAX_SMALL_N && eleFns[n] != NULL)
+    eleFns[n](A.getData(), B, C);
+  else
+    smallGemmGeneric(m, k, n, A.getData(), B, C);
+}
+
+template<typename T>
+void oppKernel::applySparse(int n, int ld, const T *vals, T *B, T *C, double beta)
+{
+  int nBlocks = (n + SPARSE_BLOCK - 1) / SPARSE_BLOCK;
+
+  // Runs serially when called from within a task [see applyCols]
+#pragma omp parallel for if(!omp_in_parallel())
+  for (int blk = 0; blk < nBlocks; blk++) {
+    int j0 = blk * SPARSE_BLOCK;
+    int j1 = std::min(j0 + SPARSE_BLOCK, n);
+
+    for (int i = 0; i < m; i++) {
+      T *Ci = C + i*ld;
+
+      if (beta == 0.)
+        for (int j = j0; j < j1; j++) Ci[j] = 0.;
+      else if (beta != 1.)
+        for (int j = j0; j < j1; j++) Ci[j] *= beta;
+
+      for (int p = rowPtr[i]; p < rowPtr[i+1]; p++) {
+        T a = vals[p];
+        T *Bp = B + colInd[p]*ld;
+        for (int j = j0; j < j1; j++)
+          Ci[j] += a * Bp[j];
+      }
+    }
+  }
+}
+
+void oppTuner::setup(input *_params)
+{
+  params = _params;
+
+  char host[256];
+  if (gethostname(host, 256) != 0)
+    sprintf(host, "unknown");
+  host[255] = '\0';
+
+#ifdef _OMP
+  nThreads = omp_get_max_threads();
+#else
+  nThreads = 1;
+#endif
+
+#ifndef _NO_MPI
+  // All ranks share rank 0's choices [and cache-file entries]
+  MPI_Bcast(host, 256, MPI_CHAR, 0, MPI_COMM_WORLD);
+  MPI_Bcast(&nThreads, 1, MPI_INT, 0, MPI_COMM_WORLD);
+#endif
+
+  hostName = host;
+
+  cache.clear();
+  newEntries.clear();
+
+  ifstream cacheFile(params->autotuneFile.c_str());
+  if (!cacheFile.is_open()) return;
+
+  string line;
+  while (getline(cacheFile, line)) {
+    if (line.empty() || line[0] == '#') continue;
+
+    // Line format: host nThreads name m n k backend
+    stringstream ss(line);
+    string host, name;
+    int nt, m, n, k, backend;
+    if (!(ss >> host >> nt >> name >> m >> n >> k >> backend)) continue;
+
+    stringstream key;
+    key << host << " " << nt << " " << name << " " << m << " " << n << " " << k;
+    cache[key.str()] = backend;
+  }
+}
+
+string oppTuner::getKey(const oppKernel &kern, int n, bool single)
+{
+  // Single-precision kernels are cached separately
+  string name = kern.name;
+  if (single) name += "_sp";
+
+  stringstream key;
+  key << hostName << " " << nThreads << " " << name << " " << kern.m << " " << n << " " << kern.k;
+  return key.str();
+}
+
+template<typename T>
+void oppTuner::tune(oppKernel &kern, int n, double beta)
+{
+  if (kern.m == 0 || kern.k == 0) return;
+
+  /* --- Every rank must make the same choice: key the cache on the largest
+   * local size, and time the candidates on all ranks together --- */
+
+  int nMax = n;
+#ifndef _NO_MPI
+  MPI_Allreduce(&n, &nMax, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+#endif
+
+  if (nMax == 0) return;
+
+  string key = getKey(kern, nMax, sizeof(T) == sizeof(float));
+
+  int cached = cache.count(key);
+#ifndef _NO_MPI
+  MPI_Allreduce(MPI_IN_PLACE, &cached, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+#endif
+
+  if (cached) {
+    kern.backend = cache[key];
+    return;
+  }
+
+  vector<int> candidates = {OPP_BLAS, OPP_SPARSE};
+#ifdef _OMP
+  candidates.push_back(OPP_BLAS_OMP);
+#endif
+
+  // Deterministic operands, so that denormals or NaNs can't skew the timings
+  vector<T> B(kern.k*n), C(kern.m*n, 0);
+  for (uint i = 0; i < B.size(); i++)
+    B[i] = 1. + 0.5*((i*7919) % 1000)/1000.;
+
+  vector<double> times(candidates.size(), 0.);
+  for (uint c = 0; c < candidates.size(); c++) {
+    if (n == 0) continue;
+
+    double time = INFINITY;
+    for (int rep = 0; rep <= N_TUNE_REPS; rep++) {
+      auto t0 = std::chrono::high_resolution_clock::now();
+      kern.apply(n, B.data(), C.data(), beta, candidates[c]);
+      auto t1 = std::chrono::high_resolution_clock::now();
+
+      // First call is a warm-up
+      if (rep > 0)
+        time = std::min(time, std::chrono::duration<double>(t1 - t0).count());
+    }
+    times[c] = time;
+  }
+
+#ifndef _NO_MPI
+  // The slowest rank sets the pace of every stage
+  MPI_Allreduce(MPI_IN_PLACE, times.data(), times.size(), MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+#endif
+
+  double bestTime = INFINITY;
+  for (uint c = 0; c < candidates.size(); c++) {
+    if (times[c] < bestTime) {
+      bestTime = times[c];
+      kern.backend = candidates[c];
+    }
+  }
+
+  cache[key] = kern.backend;
+
+  stringstream line;
+  line << key << " " << kern.backend;
+  newEntries.push_back(line.str());
+
+  if (params->rank == 0)
+    cout << "  Autotune: " << kern.name << " (" << kern.m << "x" << kern.k << ", n=" << nMax
+         << ") -> backend " << kern.backend << endl;
+}
+
+template void oppTuner::tune<double>(oppKernel &kern, int n, double beta);
+template void oppTuner::tune<float>(oppKernel &kern, int n, double beta);
+
+void oppTuner::writeCache(void)
+{
+  if (newEntries.empty()) return;
+
+  // The choices are the same on every rank; only rank 0 writes them
+  if (params->rank != 0) {
+    newEntries.clear();
+    return;
+  }
+
+  stringstream ss;
+  for (auto &line : newEntries)
+    ss << line << "\n";
+
+  ofstream cacheFile(params->autotuneFile.c_str(), ios::app);
+  if (!cacheFile.is_open()) {
+    cout << "Warning: Unable to write autotune cache file " << params->autotuneFile << endl;
+    return;
+  }
+
+  cacheFile << ss.str() << flush;
+  cacheFile.close();
+
+  newEntries.clear();
+}
@@ -28,6 +28,8 @@
  */
 #include "../include/matrix.hpp"
 
+#include <atomic>
+#include <functional>
 #include <set>
 
 #ifndef _NO_MPI
@@ -667,30 +669,73 @@ bool matrix<T>::checkNan(void)
 template<typename T>
 void matrix<T>::unique(matrix<T>& out, vector<int> &iRow)
 {
-  out.setup(0,0);
-
-  // Setup vector for rows of final matrix that map to each row of initial matrix
-  iRow.resize(this->dims[0]);
-  iRow.assign(this->dims[0],-1);
+  int nRows = this->dims[0];
+  int nCols = this->dims[1];
+  const T *rows = this->data.data();
+
+  iRow.assign(nRows,-1);
+
+  /* --- Hash each row into an open-addressing table, which keeps the index
+     of the first occurence of each distinct row --- */
+
+  size_t tableSize = 16;
+  while (tableSize < 2*(size_t)nRows) tableSize *= 2;
+  size_t mask = tableSize - 1;
+
+  vector<std::atomic<int>> table(tableSize);
+#pragma omp parallel for
+  for (size_t k=0; k<tableSize; k++)
+    table[k].store(-1, std::memory_order_relaxed);
+
+  // Table slot of each row's first occurence
+  vector<size_t> slot(nRows);
+
+#pragma omp parallel for
+  for (int i=0; i<nRows; i++) {
+    const T *rowI = rows + (size_t)i*nCols;
+
+    size_t h = 0;
+    for (int j=0; j<nCols; j++)
+      h ^= std::hash<T>()(rowI[j]) + 0x9e3779b97f4a7c15ULL + (h<<6) + (h>>2);
+    h ^= h >> 31;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 29;
+
+    size_t k = h & mask;
+    while (true) {
+      int i0 = table[k].load();
+      if (i0 == -1) {
+        if (table[k].compare_exchange_strong(i0,i)) break;
+        // Another thread just took this slot; re-check it
+        continue;
+      }
 
-  /* --- For each row in the matrix, compare to all
-     previous rows to get first unique occurence --- */
-  typename vector<T>::iterator itI, itJ;
-  for (uint i=0; i<this->dims[0]; i++) {
-    itI = this->data.begin() + i*this->dims[1];
-    for (uint j=0; j<i; j++) {
-      itJ = this->data.begin() + j*this->dims[1];
-      if (equal(itI,itI+this->dims[1],itJ)) {
-        iRow[i] = iRow[j];
+      if (std::equal(rowI, rowI+nCols, rows + (size_t)i0*nCols)) {
+        // Same row; keep the lowest index [the slot only ever holds copies of this row]
+        while (i < i0 && !table[k].compare_exchange_weak(i0,i)) {}
         break;
       }
-    }
 
-    // If no prior occurance found, put in 'out' matrix
-    if (iRow[i]==-1) {
-      out.insertRow(&(this->data[i*this->dims[1]]),-1,this->dims[1]);
-      iRow[i] = out.getDim0() - 1;
+      k = (k+1) & mask;
     }
+
+    slot[i] = k;
+  }
+
+  /* --- Number the unique rows in order of first occurence [as before] --- */
+
+  int nUnique = 0;
+  for (int i=0; i<nRows; i++) {
+    int i0 = table[slot[i]].load(std::memory_order_relaxed);
+    iRow[i] = (i0 == i) ? nUnique++ : iRow[i0];
+  }
+
+  out.setup(nUnique, (nUnique > 0) ? nCols : 0);
+
+#pragma omp parallel for
+  for (int i=0; i<nRows; i++) {
+    if (table[slot[i]].load(std::memory_order_relaxed) == i)
+      std::copy(rows + (size_t)i*nCols, rows + (size_t)(i+1)*nCols, out.data.begin() + (size_t)iRow[i]*nCols);
   }
 }
 
@@ -1028,6 +1073,11 @@ template class Array<double,2>;
 template class Array<double,3>;
 template class Array<double,4>;
 
+template class Array<float,1>;
+template class Array<float,2>;
+template class Array<float,3>;
+template class Array<float,4>;
+
 template class Array<double*,1>;
 template class Array<double*,2>;
 template class Array<double*,3>;
@@ -1048,6 +1098,8 @@ template class Array2D<double>;
 template class Array2D<point>;
 template class Array2D<Array<double,3>>;
 template class Array<Array<double,3>,2>;
+template class Array2D<Array<float,3>>;
+template class Array<Array<float,3>,2>;
 
 template class matrix<int>;
 template class matrix<double>;
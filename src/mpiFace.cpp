@@ -159,8 +159,10 @@ void mpiFace::getRightState(void)
 {
 #ifndef _NO_MPI
   // Make sure the communication is complete & transfer from buffer
+  double t0 = MPI_Wtime();
   MPI_Wait(&UL_out,&status);
   MPI_Wait(&UR_in,&status);
+  waitTime += MPI_Wtime() - t0;
 
   // Copy UR from the buffer to the proper matrix [note that the order of the
   // fpts is reversed between the two faces]
@@ -179,8 +181,10 @@ void mpiFace::getRightGradient(void)
 #ifndef _NO_MPI
   // Make sure the communication is complete & transfer from buffer
   if (params->viscous) {
+    double t0 = MPI_Wtime();
     MPI_Wait(&gradUL_out,&status);
     MPI_Wait(&gradUR_in,&status);
+    waitTime += MPI_Wtime() - t0;
 
     // Copy UR from the buffer to the proper matrix [note that the order of the
     // fpts is reversed between the two faces]
@@ -317,11 +317,9 @@ void multiGrid::restrict_pmg(solver &grid_f, solver &grid_c)
   if (grid_f.order - grid_c.order > 1)
     FatalError("Cannot restrict more than 1 order currently!");
 
-  int m = grid_c.nSpts;
-  int k = grid_f.nSpts;
   int n = grid_c.nEles * grid_c.nFields;
 
-  auto &opp_res = grid_f.opers[grid_f.order].opp_restrict(0,0);
+  auto &kern_res = grid_f.opers[grid_f.order].kern_restrict;
 
   auto &UF = grid_f.U_spts(0,0,0);
   auto &UC = grid_c.U_spts(0,0,0);
@@ -329,19 +327,8 @@ void multiGrid::restrict_pmg(solver &grid_f, solver &grid_c)
   auto &dfF = grid_f.divF_spts[0](0,0,0);
   auto &dfC = grid_c.divF_spts[0](0,0,0);
 
-#ifdef _OMP
-  omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-              1.0, &opp_res, k, &UF, n, 0.0, &UC, n);
-
-  omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-              1.0, &opp_res, k, &dfF, n, 0.0, &dfC, n);
-#else
-  cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-              1.0, &opp_res, k, &UF, n, 0.0, &UC, n);
-
-  cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-              1.0, &opp_res, k, &dfF, n, 0.0, &dfC, n);
-#endif
+  kern_res.apply(n, &UF, &UC, 0.0);
+  kern_res.apply(n, &dfF, &dfC, 0.0);
 }
 
 void multiGrid::prolong_err(solver &grid_c, solver &grid_f)
@@ -355,7 +342,7 @@ void multiGrid::prolong_err(solver &grid_c, solver &grid_f)
   auto &U = grid_f.U_spts(0,0,0);
 
 #ifdef _OMP
-  omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+  omp_blocked_gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
               1.0, &opp_pro, k, &corr, n, 1.0, &U, n);
 #else
   cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
@@ -60,6 +60,9 @@ void oper::setupOperators(uint eType, uint order, geo *inGeo, input *inParams)
   else
     FatalError("Only quads and hexes implemented.");
 
+  if (order+1 > MAX_PTS_1D)
+    FatalError("Polynomial order too high; increase MAX_PTS_1D in operators.hpp.");
+
   loc_spts = getLocSpts(eType,order,sptsType);
   loc_fpts = getLocFpts(eType,order,sptsType);
   loc_ppts = getLocPpts(eType,order,sptsType);
@@ -69,6 +72,8 @@ void oper::setupOperators(uint eType, uint order, geo *inGeo, input *inParams)
   nFpts = loc_fpts.size();
   nPpts = loc_ppts.size();
 
+  loc_spts_1D = getPts1D(sptsType,order);
+
   tempFn.setup(nFpts,nDims);
 
   // Set up each operator
@@ -95,6 +100,13 @@ void oper::setupOperators(uint eType, uint order, geo *inGeo, input *inParams)
 
   setupInterpolateSptsQpts(params->quadOrder);
 
+  setupEleKernels();
+
+  // Modal-coefficient output
+  if (params->plotType == 2) {
+    setupSptsModes();
+  }
+
   // Operators needed for Shock capturing
   if (params->scFlag) {
     setupVandermonde();
@@ -307,6 +319,13 @@ void oper::getBasisValues(double* loc_ipt, double* weights)
   // loc_ipt contains [x,y,z] in reference coordinates
   // Note: 'weights' should be pre-size to nSpts
 
+  // 1D Lagrange values in each direction [tensor-product elements]
+  double lag[3][MAX_PTS_1D];
+  if (eType == QUAD || eType == HEX)
+    for (uint dim = 0; dim < nDims; dim++)
+      for (uint i = 0; i < order+1; i++)
+        lag[dim][i] = Lagrange(loc_spts_1D,loc_ipt[dim],i);
+
   switch(eType) {
     case TRI: {
       // Use the orthogonal 2D Dubiner basis for triangular elements
@@ -316,25 +335,23 @@ void oper::getBasisValues(double* loc_ipt, double* weights)
       break;
     }
     case QUAD: {
-      vector<double> locSpts1D = getPts1D(params->sptsTypeQuad,order);
       for (uint spt=0; spt<nSpts; spt++) {
         // Structured I,J indices of current solution point
         uint ispt = spt%(order+1);
-        uint jspt = floor(spt/(order+1));
-        // 3D Tensor-Product Lagrange Interpolation
-        weights[spt] =  Lagrange(locSpts1D,loc_ipt[0],ispt) * Lagrange(locSpts1D,loc_ipt[1],jspt);
+        uint jspt = spt/(order+1);
+        // 2D Tensor-Product Lagrange Interpolation
+        weights[spt] = lag[0][ispt] * lag[1][jspt];
       }
       break;
     }
     case HEX: {
-      vector<double> locSpts1D = getPts1D(params->sptsTypeQuad,order);
       for (uint spt=0; spt<nSpts; spt++) {
         // Structured I,J,K indices of current solution point
         uint kspt = spt/((order+1)*(order+1));
         uint jspt = (spt-(order+1)*(order+1)*kspt)/(order+1);
         uint ispt = spt - (order+1)*jspt - (order+1)*(order+1)*kspt;
         // 3D Tensor-Product Lagrange Interpolation
-        weights[spt] =  Lagrange(locSpts1D,loc_ipt[0],ispt) * Lagrange(locSpts1D,loc_ipt[1],jspt) * Lagrange(locSpts1D,loc_ipt[2],kspt);
+        weights[spt] = lag[0][ispt] * lag[1][jspt] * lag[2][kspt];
       }
       break;
     }
@@ -456,32 +473,17 @@ void oper::interpolateToPoint(matrix<double> &Q_spts, double* Q_ipts, point &loc
           Q_ipts[field] += Q_spts(spt,field) * eval_dubiner_basis_2d(loc_ipt,spt,order);
       break;
     }
-    case QUAD: {
-      vector<double> locSpts1D = getPts1D(params->sptsTypeQuad,order);
-      for (uint spt=0; spt<nSpts; spt++) {
-        // Structured I,J indices of current solution point
-        uint ispt = spt%(nSpts/(order+1));
-        uint jspt = floor(spt/(order+1));
-
-        // 3D Tensor-Product Lagrange Interpolation
-        for (uint field=0; field<nFields; field++)
-          Q_ipts[field] += Q_spts(spt,field) * Lagrange(locSpts1D,loc_ipt.x,ispt) * Lagrange(locSpts1D,loc_ipt.y,jspt);
-      }
-      break;
-    }
-
+    case QUAD:
     case HEX: {
-      vector<double> locSpts1D = getPts1D(params->sptsTypeQuad,order);
-      for (uint spt=0; spt<nSpts; spt++) {
-        // Structured I,J,K indices of current solution point
-        uint kspt = spt/((order+1)*(order+1));
-        uint jspt = (spt-(order+1)*(order+1)*kspt)/(order+1);
-        uint ispt = spt - (order+1)*jspt - (order+1)*(order+1)*kspt;
+      // Tensor-product basis values, then a fixed-size [1 x nSpts] * [nSpts x nFields] kernel
+      double loc[3] = {loc_ipt.x, loc_ipt.y, loc_ipt.z};
+      double weights[MAX_PTS_1D*MAX_PTS_1D*MAX_PTS_1D];
+      getBasisValues(loc, weights);
 
-        // 3D Tensor-Product Lagrange Interpolation
-        for (uint field=0; field<nFields; field++)
-          Q_ipts[field] += Q_spts(spt,field) * Lagrange(locSpts1D,loc_ipt.x,ispt) * Lagrange(locSpts1D,loc_ipt.y,jspt) * Lagrange(locSpts1D,loc_ipt.z,kspt);
-      }
+      if (nFields <= MAX_SMALL_N && interpFns[nFields] != NULL)
+        interpFns[nFields](weights, Q_spts.getData(), Q_ipts);
+      else
+        smallGemmGeneric(1, nSpts, nFields, weights, Q_spts.getData(), Q_ipts);
       break;
     }
     default:
@@ -1000,6 +1002,38 @@ void oper::setupCorrectGradU(void)
   }
 }
 
+void oper::setupSptsModes(void)
+{
+  if (eType != QUAD && eType != HEX)
+    FatalError("Modal output only implemented for quads & hexes.");
+
+  auto modes = getModeIndices(nDims, order);
+
+  matrix<double> vandermonde(nSpts, nSpts);
+  modeNorm.resize(nSpts);
+  modeDegree.resize(nSpts);
+
+  for (uint mode = 0; mode < nSpts; mode++) {
+    auto &m = modes[mode];
+
+    modeDegree[mode] = m[0] + m[1] + m[2];
+
+    // ||P_n||^2 = 2/(2n+1) in each direction
+    modeNorm[mode] = 1.;
+    for (uint dim = 0; dim < nDims; dim++)
+      modeNorm[mode] *= 2. / (2*m[dim] + 1);
+
+    for (uint spt = 0; spt < nSpts; spt++) {
+      double val = Legendre(loc_spts[spt].x, m[0]) * Legendre(loc_spts[spt].y, m[1]);
+      if (nDims == 3)
+        val *= Legendre(loc_spts[spt].z, m[2]);
+      vandermonde(spt, mode) = val;
+    }
+  }
+
+  opp_spts_to_modes = vandermonde.invertMatrix();
+}
+
 // Setup Vandermonde Matrices
 void oper::setupVandermonde(void)
 {
@@ -1104,8 +1138,12 @@ void oper::setupFilterMatrix(void)
 
 void oper::applyGradSpts(matrix<double> &U_spts, vector<matrix<double> > &dU_spts)
 {
-  for (uint dim=0; dim<nDims; dim++)
-    opp_grad_spts[dim].timesMatrix(U_spts,dU_spts[dim]);
+  uint n = U_spts.getDim1();
+  for (uint dim=0; dim<nDims; dim++) {
+    if (dU_spts[dim].getDim0() != nSpts || dU_spts[dim].getDim1() != n)
+      dU_spts[dim].setup(nSpts,n);
+    kern_grad_spts[dim].applyEle(n, U_spts.getData(), dU_spts[dim].getData());
+  }
 }
 
 void oper::applyGradFSpts(vector<matrix<double>> &F_spts, Array<matrix<double>,2> &dF_spts)
@@ -1127,12 +1165,33 @@ void oper::applyDivFSpts(vector<matrix<double>> &F_spts, matrix<double> &divF_sp
 
 void oper::applySptsFpts(matrix<double> &U_spts, matrix<double> &U_fpts)
 {
-  opp_spts_to_fpts.timesMatrix(U_spts,U_fpts);
+  uint n = U_spts.getDim1();
+  if (U_fpts.getDim0() != nFpts || U_fpts.getDim1() != n)
+    U_fpts.setup(nFpts,n);
+  kern_spts_to_fpts.applyEle(n, U_spts.getData(), U_fpts.getData());
 }
 
 void oper::applySptsMpts(matrix<double> &U_spts, matrix<double> &U_mpts)
 {
-  opp_spts_to_mpts.timesMatrix(U_spts,U_mpts);
+  uint m = opp_spts_to_mpts.getDim0();
+  uint n = U_spts.getDim1();
+  if (U_mpts.getDim0() != m || U_mpts.getDim1() != n)
+    U_mpts.setup(m,n);
+  kern_spts_to_mpts.applyEle(n, U_spts.getData(), U_mpts.getData());
+}
+
+void oper::setupEleKernels(void)
+{
+  kern_spts_to_fpts.setup(opp_spts_to_fpts, "spts_to_fpts");
+  kern_spts_to_mpts.setup(opp_spts_to_mpts, "spts_to_mpts");
+
+  kern_grad_spts.resize(nDims);
+  for (uint dim = 0; dim < nDims; dim++)
+    kern_grad_spts[dim].setup(opp_grad_spts[dim], "grad_spts_"+to_string(dim));
+
+  interpFns[0] = NULL;
+  for (int n = 1; n <= MAX_SMALL_N; n++)
+    interpFns[n] = getSmallGemm(1, nSpts, n);
 }
 
 void oper::applyExtrapolateFn(Array<double,3> &F_spts, matrix<double> &Fn_fpts)
@@ -1146,7 +1205,7 @@ void oper::applyExtrapolateFn(Array<double,3> &F_spts, matrix<double> &Fn_fpts)
   auto &A = opp_extrapolateFn[0](0,0);
   auto &B = F_spts(0, 0, 0);
 #ifdef _OMP
-  omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+  omp_blocked_gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
               1.0, &A, k, &B, n, 0.0, &C, n);
 #else
   cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
@@ -1157,7 +1216,7 @@ void oper::applyExtrapolateFn(Array<double,3> &F_spts, matrix<double> &Fn_fpts)
     auto &A = opp_extrapolateFn[dim](0,0);
     auto &B = F_spts(dim, 0, 0);
 #ifdef _OMP
-    omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+    omp_blocked_gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
                 1.0, &A, k, &B, n, 1.0, &C, n);
 #else
     cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
@@ -1183,7 +1242,7 @@ void oper::applyExtrapolateFn(Array<double,3> &F_spts, matrix<double> &norm_fpts
   auto &B = F_spts(0, 0, 0);
   auto &C = Fn_fpts(0, 0);
 #ifdef _OMP
-  omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+  omp_blocked_gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
               1.0, &A, k, &B, n, 0.0, &C, n);
 #else
   cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
@@ -1199,7 +1258,7 @@ void oper::applyExtrapolateFn(Array<double,3> &F_spts, matrix<double> &norm_fpts
     auto &B = F_spts(dim, 0, 0);
     auto &C = tempFn(0, 0);
 #ifdef _OMP
-    omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+    omp_blocked_gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
                 1.0, &A, k, &B, n, 0.0, &C, n);
 #else
     cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
@@ -1630,5 +1689,7 @@ void oper::setupPMG(int my_order)
         }
       }
     }
+
+    kern_restrict.setup(opp_restrict, "restrict");
   }
 }
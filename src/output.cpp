@@ -40,6 +40,78 @@
 #include "mpi.h"
 #endif
 
+/* ---- Background Plot-File Writer ---- */
+
+//! Shared by all calls to writeParaview & writeModal, so that one I/O thread writes every plot file
+static plotWriter vtuWriter;
+
+plotWriter::~plotWriter(void)
+{
+  if (!ioThread.joinable()) return;
+
+  // If exiting from within the I/O thread itself [FatalError], it cannot be joined
+  if (ioThread.get_id() == std::this_thread::get_id()) {
+    ioThread.detach();
+    return;
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(mtx);
+    stop = true;
+  }
+  cv.notify_all();
+  ioThread.join();
+}
+
+plotData& plotWriter::getBuffer(void)
+{
+  return buffers[fillBuf];
+}
+
+void plotWriter::submit(void)
+{
+  if (!ioThread.joinable())
+    ioThread = std::thread(&plotWriter::run, this);
+
+  {
+    std::unique_lock<std::mutex> lock(mtx);
+    cv.wait(lock, [this]{ return !busy; });
+    writeBuf = fillBuf;
+    busy = true;
+  }
+  cv.notify_all();
+
+  fillBuf = 1 - fillBuf;
+}
+
+void plotWriter::finish(void)
+{
+  std::unique_lock<std::mutex> lock(mtx);
+  cv.wait(lock, [this]{ return !busy; });
+}
+
+void plotWriter::run(void)
+{
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      cv.wait(lock, [this]{ return busy || stop; });
+      if (!busy) return;
+    }
+
+    if (buffers[writeBuf].plotType == 2)
+      writeModalData(buffers[writeBuf]);
+    else
+      writeParaviewData(buffers[writeBuf]);
+
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      busy = false;
+    }
+    cv.notify_all();
+  }
+}
+
 void writeData(solver *Solver, input *params)
 {
   if (params->plotType == 0) {
@@ -50,6 +122,12 @@ void writeData(solver *Solver, input *params)
     if (params->plotSurfaces)
       writeSurfaces(Solver,params);
   }
+  else if (params->plotType == 2) {
+    writeModal(Solver,params);
+  }
+
+  if (params->calcStats)
+    writeStats(Solver,params);
 
   /* Write out mesh in Tecplot format, with IBLANK data [Overset cases only] */
   if (params->meshType==OVERSET_MESH && params->writeIBLANK) {
@@ -57,6 +135,201 @@ void writeData(solver *Solver, input *params)
   }
 }
 
+void writeModal(solver *Solver, input *params)
+{
+  int iter = params->iter;
+
+  char fileNameC[256];
+  string fileName = params->dataFileName;
+
+  plotData &data = vtuWriter.getBuffer();
+
+  // Don't modify a buffer that may still be being written [synchronous output]
+  if (!params->asyncOutput)
+    vtuWriter.finish();
+
+  data.params = params;
+  data.plotType = 2;
+  data.iter = iter;
+  data.time = params->time;
+
+#ifndef _NO_MPI
+  sprintf(fileNameC,"%s_%.09d",&fileName[0],iter);
+  data.dataDir = string(fileNameC);
+
+  if (params->meshType == OVERSET_MESH)
+    sprintf(fileNameC,"%s_%.09d/%s%d_%.09d_%d.modal",&fileName[0],iter,&fileName[0],Solver->gridID,iter,Solver->gridRank);
+  else
+    sprintf(fileNameC,"%s_%.09d/%s_%.09d_%d.modal",&fileName[0],iter,&fileName[0],iter,params->rank);
+#else
+  sprintf(fileNameC,"%s_%.09d.modal",&fileName[0],iter);
+#endif
+  data.modalFile = string(fileNameC);
+
+  char Iter[10];
+  sprintf(Iter,"%.09d",iter);
+
+  if (params->rank == 0)
+    cout << "Writing modal file " << fileName << "_" << string(Iter) << ".modal...  " << flush;
+
+  if (params->motion != 0)
+    Solver->updatePosSptsFpts();
+
+  Solver->calcModes();
+
+  auto &opp = Solver->opers[Solver->order];
+  int nDims = Solver->nDims;
+  int nFields = Solver->nFields;
+  int nSpts = Solver->nSpts;
+  int order = Solver->order;
+
+  data.order = order;
+  data.nSpts = nSpts;
+  data.pts1D = getPts1D(params->sptsTypeQuad, order);
+  data.pts1D.insert(data.pts1D.begin(), -1.);
+  data.pts1D.push_back(1.);
+
+  // Modes kept by order truncation
+  int nModesMax = nSpts;
+  if (params->modalOrder >= 0)
+    nModesMax = std::count_if(opp.modeDegree.begin(), opp.modeDegree.end(),
+                              [&](int deg) { return deg <= params->modalOrder; });
+  nModesMax = std::max(nModesMax, 1);
+
+  data.eles.clear();
+  for (auto &e:Solver->eles) {
+    if (params->meshType == OVERSET_MESH && Solver->Geo->iblankCell[e->ID]!=NORMAL) continue;
+    data.eles.push_back(e->sID);
+  }
+
+  /* --- Snapshot the kept coefficients so the file can be written in the background --- */
+
+  data.nModes.resize(data.eles.size());
+  data.modes.clear();
+
+  vector<double> energy(nModesMax);
+  for (uint i = 0; i < data.eles.size(); i++) {
+    int ele = data.eles[i];
+
+    /* --- Energy truncation: drop the highest modes whose combined energy is
+     *     at most modalTol times the element's energy in the non-mean modes --- */
+    int nModes = nModesMax;
+    if (params->modalTol > 0) {
+      nModes = 1;
+      for (int k = 0; k < nFields; k++) {
+        double eTot = 0;
+        for (int m = 1; m < nModesMax; m++) {
+          energy[m] = Solver->U_modes(m,ele,k) * Solver->U_modes(m,ele,k) * opp.modeNorm[m];
+          eTot += energy[m];
+        }
+
+        int n = nModesMax;
+        double tail = 0;
+        while (n > 1 && tail + energy[n-1] <= params->modalTol * eTot) {
+          tail += energy[n-1];
+          n--;
+        }
+
+        nModes = std::max(nModes, n);
+      }
+    }
+
+    data.nModes[i] = nModes;
+
+    for (int dim = 0; dim < nDims; dim++)
+      for (int m = 0; m < nSpts; m++)
+        data.modes.push_back(Solver->pos_modes(m,ele,dim));
+
+    for (int k = 0; k < nFields; k++)
+      for (int m = 0; m < nModes; m++)
+        data.modes.push_back(Solver->U_modes(m,ele,k));
+  }
+
+  /* --- Format & write the file --- */
+
+  if (params->asyncOutput) {
+    vtuWriter.submit();
+    if (params->rank == 0) cout << "queued." << endl;
+  }
+  else {
+    writeModalData(data);
+    if (params->rank == 0) cout << "done." << endl;
+  }
+}
+
+void writeModalData(plotData &data)
+{
+  /* --- File layout [native byte order]:
+   *   Header:  char[8] "FLRYMODL", int version, nDims, order, nFields, equation, nEles, iter;
+   *            double time, gamma, loc_ppts_1D[order+3]
+   *   Element: int nModes, double pos_modes[nDims][nSpts], double U_modes[nFields][nModes]
+   *   Modes are tensor-product Legendre polynomials sorted by total degree [getModeIndices] --- */
+
+  input *params = data.params;
+  int nDims = params->nDims;
+  int nFields = params->nFields;
+
+#ifndef _NO_MPI
+  struct stat st = {0};
+  if (stat(data.dataDir.c_str(), &st) == -1) {
+    mkdir(data.dataDir.c_str(), 0755);
+  }
+#endif
+
+  ofstream dataFile(data.modalFile.c_str(), ofstream::binary);
+
+  char magic[8] = {'F','L','R','Y','M','O','D','L'};
+  int header[7] = {1, nDims, data.order, nFields, params->equation, (int)data.eles.size(), data.iter};
+  dataFile.write(magic, 8);
+  dataFile.write((char*)header, 7*sizeof(int));
+  dataFile.write((char*)&data.time, sizeof(double));
+  dataFile.write((char*)&params->gamma, sizeof(double));
+  dataFile.write((char*)data.pts1D.data(), data.pts1D.size()*sizeof(double));
+
+  const double *B = data.modes.data();
+  for (uint i = 0; i < data.eles.size(); i++) {
+    int nModes = data.nModes[i];
+    int nVals = nDims*data.nSpts + nFields*nModes;
+    dataFile.write((char*)&nModes, sizeof(int));
+    dataFile.write((char*)B, nVals*sizeof(double));
+    B += nVals;
+  }
+
+  dataFile.close();
+}
+
+void writeStats(solver *Solver, input *params)
+{
+  int iter = params->iter;
+
+  char fileNameC[256];
+  string fileName = params->dataFileName;
+
+#ifndef _NO_MPI
+  /* --- Each rank writes its own file into the plot-data subdirectory --- */
+  sprintf(fileNameC,"%s_%.09d",&fileName[0],iter);
+  struct stat st = {0};
+  if (stat(fileNameC, &st) == -1) {
+    mkdir(fileNameC, 0755);
+  }
+
+  sprintf(fileNameC,"%s_%.09d/%s_%.09d_%d.stats",&fileName[0],iter,&fileName[0],iter,params->rank);
+#else
+  sprintf(fileNameC,"%s_%.09d.stats",&fileName[0],iter);
+#endif
+
+  // Binary: int nSpts, nEles, nStats; double statsTime, statsLastTime; double stats_spts[nSpts][nEles][nStats]
+  ofstream statsFile(fileNameC, ofstream::binary);
+
+  int dims[3] = {(int)Solver->nSpts, (int)Solver->nEles, (int)Solver->nStats};
+  statsFile.write((char*)dims, 3*sizeof(int));
+  statsFile.write((char*)&Solver->statsTime, sizeof(double));
+  statsFile.write((char*)&Solver->statsLastTime, sizeof(double));
+  statsFile.write((char*)Solver->stats_spts.getData(), Solver->stats_spts.getSize()*sizeof(double));
+
+  statsFile.close();
+}
+
 void writeCSV(solver *Solver, input *params)
 {
   ofstream dataFile;
@@ -134,13 +407,320 @@ void writeCSV(solver *Solver, input *params)
   dataFile.close();
 }
 
-void writeParaview(solver *Solver, input *params)
+#ifndef _NO_MPI
+//! Communicator for each group of ranks sharing one aggregated .vtu file
+static MPI_Comm plotComm = MPI_COMM_NULL;
+static int plotCommFiles = 0;  //! # of files plotComm was split for
+#endif
+
+void finishWriteData(void)
+{
+  vtuWriter.finish();
+
+#ifndef _NO_MPI
+  if (plotComm != MPI_COMM_NULL) {
+    MPI_Comm_free(&plotComm);
+    plotCommFiles = 0;
+  }
+#endif
+}
+
+//! Copy src into dest, re-using dest's storage from previous snapshots
+static void copyArray(Array<double,3> &dest, Array<double,3> &src)
+{
+  dest.setup(src.dims[0], src.dims[1], src.dims[2]);
+  std::copy(src.data.begin(), src.data.end(), dest.data.begin());
+}
+
+#ifndef _NO_MPI
+/*! Gather the plot data of all ranks in a file's group onto the first rank of
+ *  the group, which then writes the data from all of the ranks as one file */
+static void gatherPlotData(solver *Solver, input *params, plotData &data, int file, int nFiles)
+{
+  // Re-split whenever the grouping changes [same on all ranks]
+  if (plotComm != MPI_COMM_NULL && plotCommFiles != nFiles)
+    MPI_Comm_free(&plotComm);
+
+  if (plotComm == MPI_COMM_NULL) {
+    MPI_Comm_split(MPI_COMM_WORLD, file, params->rank, &plotComm);
+    plotCommFiles = nFiles;
+  }
+
+  int plotRank, plotSize;
+  MPI_Comm_rank(plotComm, &plotRank);
+  MPI_Comm_size(plotComm, &plotSize);
+
+  int nPpts = data.nPpts;
+  int nFields = Solver->nFields;
+  int nDims = Solver->nDims;
+  bool motion = (params->motion != 0);
+  bool sensor = (params->scFlag == 1);
+  bool entropy = (params->equation == NAVIER_STOKES && params->calcEntropySensor);
+  int nStats = (params->calcStats) ? Solver->nStats : 0;
+
+  // Size of each element's packed data
+  int stride = nPpts * (nFields + nDims + nStats);
+  if (motion) stride += nPpts * nDims;
+  if (sensor) stride += 1;
+  if (entropy) stride += nPpts;
+
+  /* --- Pack this rank's elements --- */
+
+  int nEles = data.eles.size();
+  vector<double> sendBuf(nEles * stride);
+  for (int i = 0; i < nEles; i++) {
+    int ele = data.eles[i];
+    double *buf = &sendBuf[i * stride];
+
+    for (int k = 0; k < nPpts; k++)
+      for (int j = 0; j < nFields; j++)
+        *(buf++) = data.V_ppts(k,ele,j);
+
+    for (int k = 0; k < nPpts; k++)
+      for (int j = 0; j < nDims; j++)
+        *(buf++) = data.pos_ppts(k,ele,j);
+
+    if (motion)
+      for (int k = 0; k < nPpts; k++)
+        for (int j = 0; j < nDims; j++)
+          *(buf++) = data.gridV_ppts(k,ele,j);
+
+    if (sensor)
+      *(buf++) = data.sensor[i];
+
+    if (entropy)
+      for (int k = 0; k < nPpts; k++)
+        *(buf++) = data.errPpts[i](k);
+
+    for (int k = 0; k < nPpts; k++)
+      for (int j = 0; j < nStats; j++)
+        *(buf++) = data.stats_ppts(k,ele,j);
+  }
+
+  /* --- Gather onto the writing rank --- */
+
+  vector<int> nEles_rank(plotSize), ranks(plotSize);
+  MPI_Gather(&nEles, 1, MPI_INT, nEles_rank.data(), 1, MPI_INT, 0, plotComm);
+  MPI_Gather(&params->rank, 1, MPI_INT, ranks.data(), 1, MPI_INT, 0, plotComm);
+
+  int nTot = 0;
+  vector<int> recvCnts(plotSize), recvDisp(plotSize);
+  for (int p = 0; p < plotSize; p++) {
+    recvCnts[p] = nEles_rank[p] * stride;
+    recvDisp[p] = nTot * stride;
+    nTot += nEles_rank[p];
+  }
+
+  vector<double> recvBuf((plotRank == 0) ? nTot * stride : 0);
+  MPI_Gatherv(sendBuf.data(), nEles * stride, MPI_DOUBLE, recvBuf.data(),
+              recvCnts.data(), recvDisp.data(), MPI_DOUBLE, 0, plotComm);
+
+  if (plotRank != 0 || nTot == 0) {
+    data.vtuFile.clear();
+    data.eles.clear();
+    return;
+  }
+
+  /* --- Unpack all ranks' elements, in rank order --- */
+
+  for (int p = 0; p < plotSize; p++) {
+    data.rankPieces.push_back(ranks[p]);
+    data.rankPieces.push_back(nEles_rank[p]);
+  }
+
+  data.eles.resize(nTot);
+  data.V_ppts.setup(nPpts, nTot, nFields);
+  data.pos_ppts.setup(nPpts, nTot, nDims);
+  if (motion) data.gridV_ppts.setup(nPpts, nTot, nDims);
+  if (sensor) data.sensor.resize(nTot);
+  if (entropy) data.errPpts.resize(nTot);
+  if (nStats) data.stats_ppts.setup(nPpts, nTot, nStats);
+
+  for (int i = 0; i < nTot; i++) {
+    double *buf = &recvBuf[i * stride];
+    data.eles[i] = i;
+
+    for (int k = 0; k < nPpts; k++)
+      for (int j = 0; j < nFields; j++)
+        data.V_ppts(k,i,j) = *(buf++);
+
+    for (int k = 0; k < nPpts; k++)
+      for (int j = 0; j < nDims; j++)
+        data.pos_ppts(k,i,j) = *(buf++);
+
+    if (motion)
+      for (int k = 0; k < nPpts; k++)
+        for (int j = 0; j < nDims; j++)
+          data.gridV_ppts(k,i,j) = *(buf++);
+
+    if (sensor)
+      data.sensor[i] = *(buf++);
+
+    if (entropy) {
+      data.errPpts[i].setup(nPpts,1);
+      for (int k = 0; k < nPpts; k++)
+        data.errPpts[i](k) = *(buf++);
+    }
+
+    for (int k = 0; k < nPpts; k++)
+      for (int j = 0; j < nStats; j++)
+        data.stats_ppts(k,i,j) = *(buf++);
+  }
+}
+#endif
+
+//! Check whether an element overlaps a plot region
+static bool inPlotRegion(solver *Solver, plotRegion &R, int ele)
+{
+  if (R.wallDist > 0 && Solver->eleWallDist[ele] > R.wallDist) return false;
+
+  point minPt(INFINITY,INFINITY,INFINITY), maxPt(-INFINITY,-INFINITY,-INFINITY);
+  for (uint k = 0; k < Solver->nPpts; k++) {
+    for (int dim = 0; dim < Solver->nDims; dim++) {
+      minPt[dim] = std::min(minPt[dim], Solver->pos_ppts(k,ele,dim));
+      maxPt[dim] = std::max(maxPt[dim], Solver->pos_ppts(k,ele,dim));
+    }
+  }
+
+  if (maxPt.x < R.xmin || minPt.x > R.xmax || maxPt.y < R.ymin || minPt.y > R.ymax)
+    return false;
+
+  if (Solver->nDims == 3 && (maxPt.z < R.zmin || minPt.z > R.zmax))
+    return false;
+
+  return true;
+}
+
+//! Copy the given plot points of the given elements from src into dest
+static void copyPlotPts(Array<double,3> &dest, Array<double,3> &src, vector<int> &eles, vector<int> &ppts)
+{
+  // Whole array [full-resolution output of every element]
+  if (ppts.size() == src.dims[0] && eles.size() == src.dims[1]) {
+    copyArray(dest, src);
+    return;
+  }
+
+  int nVars = src.dims[2];
+  dest.setup(ppts.size(), eles.size(), nVars);
+  for (uint k = 0; k < ppts.size(); k++)
+    for (uint i = 0; i < eles.size(); i++)
+      std::copy_n(&src(ppts[k],eles[i],0), nVars, &dest(k,i,0));
+}
+
+void writeParaview(solver *Solver, input *params, int region)
 {
-  ofstream dataFile;
   int iter = params->iter;
 
   char fileNameC[256];
   string fileName = params->dataFileName;
+  if (region >= 0)
+    fileName += "_region" + std::to_string(region);
+
+  plotData &data = vtuWriter.getBuffer();
+
+  // Don't modify a buffer that may still be being written [synchronous output]
+  if (!params->asyncOutput)
+    vtuWriter.finish();
+
+  data.params = params;
+  data.plotType = 1;
+  data.iter = iter;
+  data.time = params->time;
+
+  char Iter[10];
+  sprintf(Iter,"%.09d",iter);
+
+  if (params->rank == 0)
+    cout << "Writing ParaView file " << fileName << "_" << string(Iter) << ".vtu...  " << flush;
+
+  /* --- Plot points to write: evenly-spaced subset of the order+3 plot points
+   *     in each direction, always including the element's corners --- */
+
+  int nPpts1D_full = Solver->order+3;
+  data.nPpts1D = nPpts1D_full;
+  if (region >= 0 && params->plotRegions[region].res > 0)
+    data.nPpts1D = params->plotRegions[region].res;
+
+  vector<int> ind1D(data.nPpts1D);
+  for (int i = 0; i < data.nPpts1D; i++)
+    ind1D[i] = std::round(i * (nPpts1D_full-1) / (double)(data.nPpts1D-1));
+
+  vector<int> ppts;
+  int nk = (params->nDims == 3) ? data.nPpts1D : 1;
+  for (int k = 0; k < nk; k++)
+    for (int j = 0; j < data.nPpts1D; j++)
+      for (int i = 0; i < data.nPpts1D; i++)
+        ppts.push_back(ind1D[i] + nPpts1D_full*(ind1D[j] + nPpts1D_full*((nk > 1) ? ind1D[k] : 0)));
+
+  data.nPpts = ppts.size();
+
+  /* --- Compute the plot data & snapshot it --- */
+
+  vector<int> eles;
+  data.eles.clear();
+  data.iblankEle.clear();
+  data.sensor.clear();
+  data.errPpts.clear();
+
+  if (Solver->eles.size() > 0) {
+    Solver->extrapolateUPpts();
+
+    if (params->motion)
+      Solver->extrapolateGridVelPpts();
+
+    if (params->equation == NAVIER_STOKES) {
+      if (params->squeeze) {
+        Solver->calcAvgSolution();
+        Solver->checkEntropyPlot();
+      }
+
+      if (params->calcEntropySensor) {
+        Solver->calcEntropyErr_spts();
+        Solver->extrapolateSFpts();
+        Solver->extrapolateSMpts();
+      }
+    }
+
+    if (params->motion != 0)
+      Solver->updatePosSptsFpts();
+
+    if (params->meshType == OVERSET_MESH)
+      data.iblankCell = Solver->Geo->iblankCell;
+
+    for (auto& e:Solver->eles) {
+      if (params->meshType == OVERSET_MESH && Solver->Geo->iblankCell[e->ID]!=NORMAL) continue;
+
+      if (region >= 0 && !inPlotRegion(Solver, params->plotRegions[region], e->sID)) continue;
+
+      data.eles.push_back(eles.size());
+      eles.push_back(e->sID);
+
+      if (params->meshType == OVERSET_MESH)
+        data.iblankEle.push_back(Solver->Geo->iblankCell[e->ID]);
+
+      // Shock Capturing stuff
+      if (params->scFlag == 1)
+        data.sensor.push_back(e->getSensor());
+
+      if (params->equation == NAVIER_STOKES && params->calcEntropySensor) {
+        matrix<double> errPpts;
+        e->getEntropyErrPlot(errPpts);
+        data.errPpts.push_back(matrix<double>(data.nPpts,1));
+        for (int k = 0; k < data.nPpts; k++)
+          data.errPpts.back()(k) = errPpts(ppts[k]);
+      }
+    }
+
+    copyPlotPts(data.V_ppts, Solver->V_ppts, eles, ppts);
+    copyPlotPts(data.pos_ppts, Solver->pos_ppts, eles, ppts);
+    if (params->motion)
+      copyPlotPts(data.gridV_ppts, Solver->gridV_ppts, eles, ppts);
+
+    if (params->calcStats) {
+      Solver->extrapolateStatsPpts();
+      copyPlotPts(data.stats_ppts, Solver->stats_ppts, eles, ppts);
+    }
+  }
 
 #ifndef _NO_MPI
   /* --- All processors write their solution to their own .vtu file --- */
@@ -153,35 +733,207 @@ void writeParaview(solver *Solver, input *params)
   sprintf(fileNameC,"%s_%.09d.vtu",&fileName[0],iter);
 #endif
 
-  char Iter[10];
-  sprintf(Iter,"%.09d",iter);
+  data.vtuFile = (data.eles.size() > 0) ? string(fileNameC) : string("");
 
-  if (params->rank == 0)
-    cout << "Writing ParaView file " << fileName << "_" << string(Iter) << ".vtu...  " << flush;
+  data.dataDir.clear();
+  data.pvtuFile.clear();
+  data.epartFile.clear();
+  data.pvtuPieces.clear();
+  data.rankPieces.clear();
 
 #ifndef _NO_MPI
-  // Get # of eles on each rank to avoid printing completely-blanked ranks (if exist)
-  int nEles = Solver->eles.size();
+  // Get # of eles on each rank to avoid printing completely-blanked [or out-of-region] ranks (if exist)
+  int nEles = data.eles.size();
   vector<int> nEles_rank(Solver->nprocPerGrid);
   MPI_Allgather(&nEles,1,MPI_INT,nEles_rank.data(),1,MPI_INT,Solver->Geo->gridComm);
 
-  /* --- Write 'master' .pvtu file (for each grid, if overset) --- */
+  /* --- Aggregated output: rank r's data is written to file r*nFiles/nproc by
+   *     the first rank of that file's group [see gatherPlotData] --- */
+  int nFiles = std::min(params->nPlotFiles, params->nproc);
+  int file = (nFiles > 0) ? params->rank * nFiles / params->nproc : params->rank;
+  if (nFiles > 0) {
+    sprintf(fileNameC,"%s_%.09d/%s_%.09d_%d.vtu",&fileName[0],iter,&fileName[0],iter,file);
+    data.vtuFile = string(fileNameC);
+  }
+
+  /* --- Every rank creates the subdirectory for the .vtu files if it doesn't
+   *     exist yet, so no barrier is needed before writing --- */
+  sprintf(fileNameC,"%s_%.09d",&fileName[0],iter);
+  data.dataDir = string(fileNameC);
+
+  /* --- Partition of each grid which may be rebalanced, as the restart data
+   *     is only valid on it [see geo::partitionMesh] --- */
+  if (params->meshType == OVERSET_MESH && params->rebalanceFreq > 0 && region < 0 &&
+      Solver->gridRank == 0 && !Solver->Geo->epart.empty()) {
+    sprintf(fileNameC,"%s_%.09d/%s%d_%.09d.epart",&fileName[0],iter,&fileName[0],Solver->gridID,iter);
+    data.epartFile = string(fileNameC);
+    data.epart = Solver->Geo->epart;
+  }
+
+  /* --- 'Master' .pvtu file (for each grid, if overset) --- */
   if (Solver->gridRank == 0) {
-    ofstream pVTU;
-    char pvtuC[256];
     if (params->meshType == OVERSET_MESH)
-      sprintf(pvtuC,"%s%d_%.09d.pvtu",&fileName[0],Solver->gridID,iter);
+      sprintf(fileNameC,"%s%d_%.09d.pvtu",&fileName[0],Solver->gridID,iter);
     else
-      sprintf(pvtuC,"%s_%.09d.pvtu",&fileName[0],iter);
+      sprintf(fileNameC,"%s_%.09d.pvtu",&fileName[0],iter);
+    data.pvtuFile = string(fileNameC);
+
+    if (nFiles > 0) {
+      vector<int> nEles_file(nFiles, 0);
+      for (int p=0; p<params->nproc; p++)
+        nEles_file[p * nFiles / params->nproc] += nEles_rank[p];
+
+      for (int f=0; f<nFiles; f++) {
+        sprintf(fileNameC,"%s_%.09d/%s_%.09d_%d.vtu",&fileName[0],iter,&fileName[0],iter,f);
+        if (nEles_file[f]>0)
+          data.pvtuPieces.push_back(string(fileNameC));
+      }
+    }
 
-    pVTU.open(pvtuC);
+    for (int p=0; p<Solver->nprocPerGrid && nFiles == 0; p++) {
+      if (params->meshType == OVERSET_MESH)
+        sprintf(fileNameC,"%s_%.09d/%s%d_%.09d_%d.vtu",&fileName[0],iter,&fileName[0],Solver->gridID,iter,p);
+      else
+        sprintf(fileNameC,"%s_%.09d/%s_%.09d_%d.vtu",&fileName[0],iter,&fileName[0],iter,p);
+      if (nEles_rank[p]>0)
+        data.pvtuPieces.push_back(string(fileNameC));
+    }
+  }
+
+  if (nFiles > 0)
+    gatherPlotData(Solver, params, data, file, nFiles);
+#endif
+
+  /* --- Format & write the files --- */
+
+  if (params->asyncOutput) {
+    vtuWriter.submit();
+    if (params->rank == 0) cout << "queued." << endl;
+  }
+  else {
+    writeParaviewData(data);
+    if (params->rank == 0) cout << "done." << endl;
+  }
+}
+
+void writeRegions(solver *Solver, input *params)
+{
+  /* --- On moving grids, the elements [blanking] & their distance from the
+   * walls change every step; update them before any wallDist region is written --- */
+  if (params->motion) {
+    bool needDist = false;
+    for (auto &R:params->plotRegions)
+      if (R.wallDist > 0 && params->iter % R.freq == 0) needDist = true;
+
+    if (needDist) Solver->calcWallDistance();
+  }
+
+  for (uint r = 0; r < params->plotRegions.size(); r++) {
+    if (params->iter % params->plotRegions[r].freq == 0)
+      writeParaview(Solver, params, r);
+  }
+}
+
+/*! Write the running statistics [mean, RMS, & Reynolds stresses] of one element's plot points */
+static void writeStatsData(ofstream &dataFile, plotData &data, int ele, int nPpts)
+{
+  input *params = data.params;
+  int nDims = params->nDims;
+  int nFields = params->nFields;
+
+  // stats_ppts layout: [means, variances, velocity cross-covariances (uv, uw, vw)]
+  auto &S = data.stats_ppts;
+
+  /* --- Mean & RMS Density --- */
+  dataFile << "				<DataArray type=\"Float32\" Name=\"MeanDensity\" format=\"ascii\">" << endl;
+  for(int k=0; k<nPpts; k++) {
+    dataFile << S(k,ele,0) << " ";
+  }
+  dataFile << endl;
+  dataFile << "				</DataArray>" << endl;
+
+  dataFile << "				<DataArray type=\"Float32\" Name=\"RMSDensity\" format=\"ascii\">" << endl;
+  for(int k=0; k<nPpts; k++) {
+    dataFile << std::sqrt(std::max(S(k,ele,nFields),0.)) << " ";
+  }
+  dataFile << endl;
+  dataFile << "				</DataArray>" << endl;
+
+  if (params->equation != NAVIER_STOKES) return;
+
+  /* --- Mean Velocity --- */
+  dataFile << "				<DataArray type=\"Float32\" NumberOfComponents=\"3\" Name=\"MeanVelocity\" format=\"ascii\">" << endl;
+  for(int k=0; k<nPpts; k++) {
+    dataFile << S(k,ele,1) << " " << S(k,ele,2) << " ";
+    dataFile << ((nDims == 3) ? S(k,ele,3) : 0.0) << " ";
+  }
+  dataFile << endl;
+  dataFile << "				</DataArray>" << endl;
+
+  /* --- Mean & RMS Pressure --- */
+  dataFile << "				<DataArray type=\"Float32\" Name=\"MeanPressure\" format=\"ascii\">" << endl;
+  for(int k=0; k<nPpts; k++) {
+    dataFile << S(k,ele,nDims+1) << " ";
+  }
+  dataFile << endl;
+  dataFile << "				</DataArray>" << endl;
+
+  dataFile << "				<DataArray type=\"Float32\" Name=\"RMSPressure\" format=\"ascii\">" << endl;
+  for(int k=0; k<nPpts; k++) {
+    dataFile << std::sqrt(std::max(S(k,ele,nFields+nDims+1),0.)) << " ";
+  }
+  dataFile << endl;
+  dataFile << "				</DataArray>" << endl;
+
+  /* --- Reynolds Stresses [VTK symmetric-tensor order: xx yy zz xy yz xz] --- */
+  dataFile << "				<DataArray type=\"Float32\" NumberOfComponents=\"6\" Name=\"ReynoldsStress\" format=\"ascii\">" << endl;
+  for(int k=0; k<nPpts; k++) {
+    if (nDims == 2) {
+      dataFile << S(k,ele,nFields+1) << " " << S(k,ele,nFields+2) << " " << 0.0 << " ";
+      dataFile << S(k,ele,2*nFields) << " " << 0.0 << " " << 0.0 << " ";
+    }
+    else {
+      dataFile << S(k,ele,nFields+1) << " " << S(k,ele,nFields+2) << " " << S(k,ele,nFields+3) << " ";
+      dataFile << S(k,ele,2*nFields) << " " << S(k,ele,2*nFields+2) << " " << S(k,ele,2*nFields+1) << " ";
+    }
+  }
+  dataFile << endl;
+  dataFile << "				</DataArray>" << endl;
+}
+
+void writeParaviewData(plotData &data)
+{
+  input *params = data.params;
+  ofstream dataFile;
+
+#ifndef _NO_MPI
+  /* --- Create the subdirectory to store .vtu files, if needed --- */
+  if (!data.dataDir.empty()) {
+    struct stat st = {0};
+    if (stat(data.dataDir.c_str(), &st) == -1) {
+      mkdir(data.dataDir.c_str(), 0755);
+    }
+  }
+
+  /* --- Write the grid's partition [int nEles, int epart[nEles]] --- */
+  if (!data.epartFile.empty()) {
+    ofstream epartFile(data.epartFile.c_str(), ofstream::binary);
+    int nEles = data.epart.size();
+    epartFile.write((char*)&nEles, sizeof(int));
+    epartFile.write((char*)data.epart.data(), nEles*sizeof(int));
+  }
+
+  /* --- Write 'master' .pvtu file (for each grid, if overset) --- */
+  if (!data.pvtuFile.empty()) {
+    ofstream pVTU;
+    pVTU.open(data.pvtuFile.c_str());
 
     pVTU << "<?xml version=\"1.0\" ?>" << endl;
     pVTU << "<VTKFile type=\"PUnstructuredGrid\" version=\"0.1\" byte_order=\"LittleEndian\" compressor=\"vtkZLibDataCompressor\">" << endl;
 
     // Use XML / ParaView comments here for simulation time
-    pVTU << "<!-- TIME " << params->time << " -->" << endl;
-    pVTU << "<!-- ITER " << params->iter << " -->" << endl;
+    pVTU << "<!-- TIME " << data.time << " -->" << endl;
+    pVTU << "<!-- ITER " << data.iter << " -->" << endl;
 
     pVTU << "  <PUnstructuredGrid GhostLevel=\"1\">" << endl;
     // NOTE: Must be careful with order here [particularly of vector data], or else ParaView gets confused
@@ -203,47 +955,35 @@ void writeParaview(solver *Solver, input *params)
     if (params->meshType == OVERSET_MESH && params->writeIBLANK) {
       pVTU << "      <PDataArray type=\"Float32\" Name=\"IBLANK\" />" << endl;
     }
+    if (params->calcStats) {
+      pVTU << "      <PDataArray type=\"Float32\" Name=\"MeanDensity\" />" << endl;
+      pVTU << "      <PDataArray type=\"Float32\" Name=\"RMSDensity\" />" << endl;
+      if (params->equation == NAVIER_STOKES) {
+        pVTU << "      <PDataArray type=\"Float32\" Name=\"MeanVelocity\" NumberOfComponents=\"3\" />" << endl;
+        pVTU << "      <PDataArray type=\"Float32\" Name=\"MeanPressure\" />" << endl;
+        pVTU << "      <PDataArray type=\"Float32\" Name=\"RMSPressure\" />" << endl;
+        pVTU << "      <PDataArray type=\"Float32\" Name=\"ReynoldsStress\" NumberOfComponents=\"6\" />" << endl;
+      }
+    }
     pVTU << "    </PPointData>" << endl;
     pVTU << "    <PPoints>" << endl;
     pVTU << "      <PDataArray type=\"Float32\" Name=\"Points\" NumberOfComponents=\"3\" />" << endl;
     pVTU << "    </PPoints>" << endl;
 
-    char filnameTmpC[256];
-    for (int p=0; p<Solver->nprocPerGrid; p++) {
-      if (params->meshType == OVERSET_MESH)
-        sprintf(filnameTmpC,"%s_%.09d/%s%d_%.09d_%d.vtu",&fileName[0],iter,&fileName[0],Solver->gridID,iter,p);
-      else
-        sprintf(filnameTmpC,"%s_%.09d/%s_%.09d_%d.vtu",&fileName[0],iter,&fileName[0],iter,p);
-      if (nEles_rank[p]>0)
-        pVTU << "    <Piece Source=\"" << string(filnameTmpC) << "\" />" << endl;
-    }
+    for (auto &piece:data.pvtuPieces)
+      pVTU << "    <Piece Source=\"" << piece << "\" />" << endl;
+
     pVTU << "  </PUnstructuredGrid>" << endl;
     pVTU << "</VTKFile>" << endl;
 
     pVTU.close();
-
-    char datadirC[256];
-    char *datadir = &datadirC[0];
-    sprintf(datadirC,"%s_%.09d",&fileName[0],iter);
-
-    /* --- Master node creates a subdirectory to store .vtu files --- */
-    if (params->rank == 0) {
-      struct stat st = {0};
-      if (stat(datadir, &st) == -1) {
-        mkdir(datadir, 0755);
-      }
-    }
   }
-
-  /* --- Wait for all processes to get here, otherwise there won't be a
-   *     directory to put .vtus into --- */
-  MPI_Barrier(MPI_COMM_WORLD);
 #endif
 
   /* --- Move onto the rank-specific data file --- */
-  if (Solver->eles.size()==0) return;
+  if (data.vtuFile.empty()) return;
 
-  dataFile.open(fileNameC);
+  dataFile.open(data.vtuFile.c_str());
   dataFile.precision(16);
 
   // File header
@@ -251,71 +991,39 @@ void writeParaview(solver *Solver, input *params)
   dataFile << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"LittleEndian\" compressor=\"vtkZLibDataCompressor\">" << endl;
 
   // Write simulation time and iteration number
-  dataFile << "<!-- TIME " << params->time << " -->" << endl;
-  dataFile << "<!-- ITER " << params->iter << " -->" << endl;
+  dataFile << "<!-- TIME " << data.time << " -->" << endl;
+  dataFile << "<!-- ITER " << data.iter << " -->" << endl;
 
   // Write the cell iblank data for restarting purposes
   if (params->meshType == OVERSET_MESH) {
     dataFile << "<!-- IBLANK_CELL ";
-    for (int i=0; i<Solver->Geo->nEles; i++) {
-      dataFile << Solver->Geo->iblankCell[i] << " ";
+    for (uint i=0; i<data.iblankCell.size(); i++) {
+      dataFile << data.iblankCell[i] << " ";
     }
     dataFile << " -->" << endl;
   }
 
-  dataFile << "	<UnstructuredGrid>" << endl;
-
-  Solver->extrapolateUPpts();
-
-  if (params->motion)
-    Solver->extrapolateGridVelPpts();
-
-  if (params->equation == NAVIER_STOKES) {
-    if (params->squeeze) {
-      Solver->calcAvgSolution();
-      Solver->checkEntropyPlot();
-    }
-
-    if (params->calcEntropySensor) {
-      Solver->calcEntropyErr_spts();
-      Solver->extrapolateSFpts();
-      Solver->extrapolateSMpts();
+  // Write the # of pieces from each rank in an aggregated file, for restarting
+  if (!data.rankPieces.empty()) {
+    dataFile << "<!-- RANK_PIECES ";
+    for (uint i=0; i<data.rankPieces.size(); i++) {
+      dataFile << data.rankPieces[i] << " ";
     }
+    dataFile << " -->" << endl;
   }
 
-  if (params->motion != 0)
-    Solver->updatePosSptsFpts();
-
-  for (auto& e:Solver->eles) {
-    if (params->meshType == OVERSET_MESH && Solver->Geo->iblankCell[e->ID]!=NORMAL) continue;
-
-    // The combination of spts + fpts will be the plot points
-    matrix<double> vPpts, gridVelPpts, errPpts;
-    vector<point> ppts;
-    e->getPrimitivesPlot(vPpts);
-    if (params->motion)
-      e->getGridVelPlot(gridVelPpts);
-    ppts = e->getPpts();
-
-    // Shock Capturing stuff
-    double sensor;
-    if(params->scFlag == 1) {
-      sensor = e->getSensor();
-    }
+  dataFile << "	<UnstructuredGrid>" << endl;
 
-    if (params->equation == NAVIER_STOKES && params->calcEntropySensor)
-      e->getEntropyErrPlot(errPpts);
+  for (uint i=0; i<data.eles.size(); i++) {
+    int ele = data.eles[i];
 
-    int nSubCells, nPpts;
-    int nPpts1D = e->order+3;
-    if (params->nDims == 2) {
-      nSubCells = (e->order+2)*(e->order+2);
-      nPpts = (e->order+3)*(e->order+3);
-    }
-    else if (params->nDims == 3) {
-      nSubCells = (e->order+2)*(e->order+2)*(e->order+2);
-      nPpts = (e->order+3)*(e->order+3)*(e->order+3);
-    }
+    int nSubCells;
+    int nPpts1D = data.nPpts1D;
+    int nPpts = data.nPpts;
+    if (params->nDims == 2)
+      nSubCells = (nPpts1D-1)*(nPpts1D-1);
+    else if (params->nDims == 3)
+      nSubCells = (nPpts1D-1)*(nPpts1D-1)*(nPpts1D-1);
     else
       FatalError("Invalid dimensionality [nDims].");
 
@@ -329,7 +1037,7 @@ void writeParaview(solver *Solver, input *params)
     /* --- Density --- */
     dataFile << "				<DataArray type=\"Float32\" Name=\"Density\" format=\"ascii\">" << endl;
     for(int k=0; k<nPpts; k++) {
-      dataFile << vPpts(k,0) << " ";
+      dataFile << data.V_ppts(k,ele,0) << " ";
     }
     dataFile << endl;
     dataFile << "				</DataArray>" << endl;
@@ -338,14 +1046,14 @@ void writeParaview(solver *Solver, input *params)
       /* --- Velocity --- */
       dataFile << "				<DataArray type=\"Float32\" NumberOfComponents=\"3\" Name=\"Velocity\" format=\"ascii\">" << endl;
       for(int k=0; k<nPpts; k++) {
-        dataFile << vPpts(k,1) << " " << vPpts(k,2) << " ";
+        dataFile << data.V_ppts(k,ele,1) << " " << data.V_ppts(k,ele,2) << " ";
 
         // In 2D the z-component of velocity is not stored, but Paraview needs it so write a 0.
         if(params->nDims==2) {
           dataFile << 0.0 << " ";
         }
         else {
-          dataFile << vPpts(k,3) << " ";
+          dataFile << data.V_ppts(k,ele,3) << " ";
         }
       }
       dataFile << endl;
@@ -354,7 +1062,7 @@ void writeParaview(solver *Solver, input *params)
       /* --- Pressure --- */
       dataFile << "				<DataArray type=\"Float32\" Name=\"Pressure\" format=\"ascii\">" << endl;
       for(int k=0; k<nPpts; k++) {
-        dataFile << vPpts(k,params->nDims+1) << " ";
+        dataFile << data.V_ppts(k,ele,params->nDims+1) << " ";
       }
       dataFile << endl;
       dataFile << "				</DataArray>" << endl;
@@ -363,7 +1071,7 @@ void writeParaview(solver *Solver, input *params)
         /* --- Entropy Error Estimate --- */
         dataFile << "				<DataArray type=\"Float32\" Name=\"EntropyErr\" format=\"ascii\">" << endl;
         for(int k=0; k<nPpts; k++) {
-          dataFile << std::abs(errPpts(k)) << " ";
+          dataFile << std::abs(data.errPpts[i](k)) << " ";
         }
         dataFile << endl;
         dataFile << "				</DataArray>" << endl;
@@ -374,7 +1082,7 @@ void writeParaview(solver *Solver, input *params)
       /* --- Shock Sensor --- */
       dataFile << "				<DataArray type=\"Float32\" Name=\"Sensor\" format=\"ascii\">" << endl;
       for(int k=0; k<nPpts; k++) {
-        dataFile << sensor << " ";
+        dataFile << data.sensor[i] << " ";
       }
       dataFile << endl;
       dataFile << "				</DataArray>" << endl;
@@ -385,14 +1093,14 @@ void writeParaview(solver *Solver, input *params)
       dataFile << "				<DataArray type=\"Float32\" NumberOfComponents=\"3\" Name=\"GridVelocity\" format=\"ascii\">" << endl;
       for(int k=0; k<nPpts; k++) {
         // Divide momentum components by density to obtain velocity components
-        dataFile << gridVelPpts(k,0) << " " << gridVelPpts(k,1) << " ";
+        dataFile << data.gridV_ppts(k,ele,0) << " " << data.gridV_ppts(k,ele,1) << " ";
 
         // In 2D the z-component of velocity is not stored, but Paraview needs it so write a 0.
         if(params->nDims==2) {
           dataFile << 0.0 << " ";
         }
         else {
-          dataFile << gridVelPpts(k,2) << " ";
+          dataFile << data.gridV_ppts(k,ele,2) << " ";
         }
       }
       dataFile << endl;
@@ -404,12 +1112,15 @@ void writeParaview(solver *Solver, input *params)
       dataFile << "				<DataArray type=\"Float32\" Name=\"IBLANK\" format=\"ascii\">" << endl;
 
       for(int k=0; k<nPpts; k++) {
-        dataFile << Solver->Geo->iblankCell[e->ID] << " ";
+        dataFile << data.iblankEle[i] << " ";
       }
       dataFile << endl;
       dataFile << "				</DataArray>" << endl;
     }
 
+    if (params->calcStats)
+      writeStatsData(dataFile, data, ele, nPpts);
+
     /* --- End of Cell's Solution Data --- */
 
     dataFile << "			</PointData>" << endl;
@@ -423,7 +1134,7 @@ void writeParaview(solver *Solver, input *params)
     // Loop over plot points in element
     for(int k=0; k<nPpts; k++) {
       for(int l=0;l<params->nDims;l++) {
-        dataFile << e->pos_ppts(k,l) << " ";
+        dataFile << data.pos_ppts(k,ele,l) << " ";
       }
 
       // If 2D, write a 0 as the z-component
@@ -507,8 +1218,6 @@ void writeParaview(solver *Solver, input *params)
   dataFile << "</VTKFile>" << endl;
 
   dataFile.close();
-
-  if (params->rank == 0) cout << "done." <<  endl;
 }
 
 void writeSurfaces(solver *Solver, input *params)
@@ -1209,6 +1918,65 @@ void writeResidual(solver *Solver, input *params)
   }
 }
 
+//! Binary time-series file for the point probes [rank 0 only]
+static ofstream probeFile;
+
+void writeProbes(solver *Solver, input *params)
+{
+  /* --- File layout [native byte order]:
+   *   Header: int nProbes, int nFields, double xyz[nProbes][3]
+   *   Sample: int iter, double time, double V[nProbes][nFields]  (primitives; NaN if probe not found) --- */
+
+  int nProbes = Solver->probePts.size();
+  if (nProbes == 0) return;
+
+  int nFields = params->nFields;
+
+  Solver->calcProbeData();
+
+  vector<double> V(nProbes*nFields, 0.);
+  for (uint i = 0; i < Solver->probeIDs.size(); i++)
+    for (int k = 0; k < nFields; k++)
+      V[Solver->probeIDs[i]*nFields+k] = Solver->probeV(i,k);
+
+#ifndef _NO_MPI
+  if (params->rank == 0)
+    MPI_Reduce(MPI_IN_PLACE, V.data(), nProbes*nFields, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+  else
+    MPI_Reduce(V.data(), NULL, nProbes*nFields, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD);
+#endif
+
+  if (params->rank != 0) return;
+
+  for (int p = 0; p < nProbes; p++)
+    if (Solver->probeOwner[p] == params->nproc)
+      for (int k = 0; k < nFields; k++)
+        V[p*nFields+k] = NAN;
+
+  if (!probeFile.is_open()) {
+    string fileName = params->dataFileName + ".probes";
+
+    // Continue the existing time series when restarting
+    if (params->restart) {
+      probeFile.open(fileName.c_str(), ofstream::binary | ofstream::app);
+    }
+    else {
+      probeFile.open(fileName.c_str(), ofstream::binary | ofstream::trunc);
+
+      probeFile.write((char*)&nProbes, sizeof(int));
+      probeFile.write((char*)&nFields, sizeof(int));
+      for (auto &pt:Solver->probePts) {
+        double xyz[3] = {pt.x, pt.y, pt.z};
+        probeFile.write((char*)xyz, 3*sizeof(double));
+      }
+    }
+  }
+
+  probeFile.write((char*)&params->iter, sizeof(int));
+  probeFile.write((char*)&params->time, sizeof(double));
+  probeFile.write((char*)V.data(), nProbes*nFields*sizeof(double));
+}
+
 void writeAllError(solver *Solver, input *params)
 {
   if (params->testCase == 1) {
@@ -1319,6 +2087,43 @@ void writeError(solver *Solver, input *params)
   }
 }
 
+void writeGridBalance(solver *Solver, input *params)
+{
+#ifndef _NO_MPI
+  if (params->meshType != OVERSET_MESH) return;
+
+  /* --- Work done on each grid [rank-seconds], excluding time spent waiting
+   * on the other grids or the global time-step reduction --- */
+
+  double busyTime = Solver->updateTime - Solver->waitTime;
+  if (Solver->OComm != NULL)
+    busyTime -= Solver->OComm->waitTime;
+
+  vector<double> busy_grid(Solver->nGrids), tmpBusy(Solver->nGrids);
+  tmpBusy[Solver->gridID] = busyTime;
+  MPI_Reduce(tmpBusy.data(),busy_grid.data(),Solver->nGrids,MPI_DOUBLE,MPI_SUM,0,MPI_COMM_WORLD);
+
+  if (params->rank == 0) {
+    auto nProcs = splitProcsByCost(busy_grid,params->nproc);
+
+    cout.precision(3);
+    cout.setf(ios::fixed, ios::floatfield);
+    cout << "Overset grid work [rank-s]:";
+    for (auto &t:busy_grid) cout << " " << t;
+    cout << endl;
+
+    // In the input file's format.  Restart files are tied to the partition that
+    // wrote them, so this only applies to a fresh [non-restart] run.
+    cout << "Suggested split of MPI ranks for a fresh run:  gridProcs " << Solver->nGrids;
+    for (auto &np:nProcs) cout << " " << np;
+    cout << endl;
+  }
+#else
+  (void)Solver;
+  (void)params;
+#endif
+}
+
 void writeMeshTecplot(geo *Geo, input* params)
 {
   ofstream dataFile;
@@ -33,6 +33,7 @@
 
 #include "flux.hpp"
 #include "global.hpp"
+#include "solver.hpp"
 
 #ifndef _NO_MPI
 template<typename T>
@@ -61,6 +62,23 @@ overComm::overComm()
 
 }
 
+overComm::~overComm()
+{
+#ifndef _NO_MPI
+  // A solver on the stack outlives MPI_Finalize
+  int finalized;
+  MPI_Finalized(&finalized);
+  if (finalized) return;
+
+  for (auto &req:U_requests) MPI_Request_free(&req);
+  for (auto &req:gradU_requests) MPI_Request_free(&req);
+
+  if (gridComm != MPI_COMM_NULL) MPI_Comm_free(&gridComm);
+  if (interComm != MPI_COMM_NULL) MPI_Comm_free(&interComm);
+  if (gradComm != MPI_COMM_NULL) MPI_Comm_free(&gradComm);
+#endif
+}
+
 void overComm::setup(input* _params, int _nGrids, int _gridID, int _gridRank, int _nprocPerGrid, vector<int>& _gridIdList)
 {
   params = _params;
@@ -78,6 +96,8 @@ void overComm::setup(input* _params, int _nGrids, int _gridID, int _gridRank, in
 
 #ifndef _NO_MPI
   MPI_Comm_split(MPI_COMM_WORLD, gridID, params->rank, &gridComm);
+  MPI_Comm_dup(MPI_COMM_WORLD, &interComm);
+  MPI_Comm_dup(MPI_COMM_WORLD, &gradComm);
 #endif
 }
 
@@ -269,17 +289,65 @@ void overComm::transferEleData(vector<shared_ptr<ele>> &eles, const unordered_se
 void overComm::matchOversetPoints(vector<shared_ptr<ele>> &eles, const vector<int> &eleMap, const point &minPt, const point &maxPt)
 {
 #ifndef _NO_MPI
-  /* ---- Gather all interpolation point data on each grid ---- */
-
   nOverPts = overPts.getDim0();
 
-  vector<double> interpPtsPhys;
+  // Donors are about to change; the static interpolation matrix must be rebuilt
+  haveInterpMatrix = false;
+
+  /* ---- Share partition bounding boxes across all ranks ---- */
+
+  vector<double> bbox(6);
+  for (int dim=0; dim<3; dim++) {
+    bbox[dim]   = minPt[dim];
+    bbox[3+dim] = maxPt[dim];
+  }
+
+  vector<double> bbox_rank(6*nproc);
+  MPI_Allgather(bbox.data(),6,MPI_DOUBLE,bbox_rank.data(),6,MPI_DOUBLE,MPI_COMM_WORLD);
+
+  /* ---- Send each fringe point only to the ranks whose bounding box contains it ---- */
+
+  // For flux-interp method, send the outward normal along with the point
+  int stride = (params->oversetMethod==1) ? 6 : 3;
+
+  vector<vector<int>> ptIdsSend(nproc), ptIdsRecv;
+  vector<matrix<double>> ptsSend(nproc), ptsRecv;
+  vector<int> nSend(nproc,0), nRecv;
 
-  gatherData(nOverPts, 3, overPts.getData(), nPts_rank, interpPtsPhys);
+  for (int p=0; p<nproc; p++) {
+    if (gridIdList[p] == gridID) continue;
 
-  vector<double> interpNorms;
-  if (params->oversetMethod==1)
-    gatherData(nOverPts, 3, overNorm.getData(), nPts_rank, interpNorms);
+    // Pad the box slightly to account for curved element edges
+    double *box = &bbox_rank[6*p];
+    double pad[3];
+    for (int dim=0; dim<nDims; dim++)
+      pad[dim] = 1e-6 + .01*(box[3+dim]-box[dim]);
+
+    vector<double> tmpPt(stride);
+    for (int i=0; i<nOverPts; i++) {
+      bool inBox = true;
+      for (int dim=0; dim<nDims; dim++) {
+        if (overPts(i,dim) < box[dim]-pad[dim] || overPts(i,dim) > box[3+dim]+pad[dim]) {
+          inBox = false;
+          break;
+        }
+      }
+      if (!inBox) continue;
+
+      for (int dim=0; dim<3; dim++) {
+        tmpPt[dim] = overPts(i,dim);
+        if (params->oversetMethod==1)
+          tmpPt[3+dim] = overNorm(i,dim);
+      }
+      ptIdsSend[p].push_back(i);
+      ptsSend[p].insertRow(tmpPt);
+      nSend[p]++;
+    }
+  }
+
+  setupNPieces(nSend,nRecv);
+
+  sendRecvData(nSend,nRecv,ptIdsSend,ptIdsRecv,ptsSend,ptsRecv,stride);
 
   /* ---- Check Every Fringe Point for Donor Cell on This Grid ---- */
 
@@ -302,24 +370,49 @@ void overComm::matchOversetPoints(vector<shared_ptr<ele>> &eles, const vector<in
     }
   }
 
-  int offset = 0;
   double tol = 1e-6;
   for (int p=0; p<nproc; p++) {
-    if (p>0) offset += nPts_rank[p-1];
-
     if (gridIdList[p] == gridID) continue;
 
+    // For moving grids, keep each point's previous donor & ref. location as a starting guess
+    unordered_map<int,pair<int,point>> prevDonors;
+    if (params->motion)
+      for (int k=0; k<foundPts[p].size(); k++)
+        prevDonors[foundPts[p][k]] = make_pair(foundEles[p][k],foundLocs[p][k]);
+
     foundPts[p].resize(0);
     foundEles[p].resize(0);
     foundLocs[p].resize(0);
     if (params->oversetMethod==1)
       foundNorm[p].resize(0);
-    for (int i=0; i<nPts_rank[p]; i++) {
-      // Get requested interpolation point
-      double *pt_ptr = &interpPtsPhys[3*(offset+i)];
-      double *norm_ptr = &interpNorms[3*(offset+i)];
+
+    // 2D: (point, candidate cell) pairs from the ADT, to be inverted as one batch
+    // [the candidates of each point are contiguous, from candStart[n] to candStart[n+1]]
+    vector<int> candPt, candCell, candEle;
+    vector<int> candStart(1,0);
+    vector<point> candPos;
+
+    for (int j=0; j<nRecv[p]; j++) {
+      // Get requested interpolation point [and its ID on rank p]
+      int i = ptIdsRecv[p][j];
+      double *pt_ptr = &ptsRecv[p](j,0);
+      double *norm_ptr = (params->oversetMethod==1) ? &ptsRecv[p](j,3) : NULL;
       point pt = point(pt_ptr);
 
+      if (prevDonors.count(i)) {
+        // Motion per step is small; only fall back to the global search if the point was lost
+        point refLoc = prevDonors[i].second;
+        int ic = findDonorNear(eles,eleMap,prevDonors[i].first,pt,refLoc);
+        if (ic >= 0) {
+          foundPts[p].push_back(i);
+          foundEles[p].push_back(ic);
+          foundLocs[p].push_back(refLoc);
+          if (params->oversetMethod==1)
+            foundNorm[p].push_back(point(norm_ptr));
+          continue;
+        }
+      }
+
       if (params->nDims == 2) {
         // First, check that point even lies within bounding box of grid
         if ( (pt.x<minPt.x-tol) || (pt.y<minPt.y-tol) ||
@@ -332,26 +425,13 @@ void overComm::matchOversetPoints(vector<shared_ptr<ele>> &eles, const vector<in
         adt->searchADT_box(eleList.data(),cellIDs,targetBox.data());
         for (auto &ic:cellIDs) {
           if (eleMap[ic]<0) continue;
-          point refLoc;
-          bool isInEle = eles[eleMap[ic]]->getRefLocNewton(pt,refLoc);
-
-          if (isInEle) {
-            foundPts[p].push_back(i);
-            foundEles[p].push_back(ic); // Local ele id for this grid
-            foundLocs[p].push_back(refLoc);
-            if (params->oversetMethod==1) {
-              foundNorm[p].push_back(point(norm_ptr));
-              if (!params->motion) {
-                matrix<double> jacobian, invJaco;
-                double detJac;
-                eles[eleMap[ic]]->calcTransforms_point(jacobian,invJaco,detJac,refLoc);
-                foundJaco[p].push_back(jacobian);
-                foundDetJac[p].push_back(detJac);
-              }
-            }
-            break;
-          }
+          candPt.push_back(j);
+          candCell.push_back(ic);
+          candEle.push_back(eleMap[ic]);
+          candPos.push_back(pt);
         }
+        if (candPt.size() > candStart.back())
+          candStart.push_back(candPt.size());
       }
       else {
         int ic = tg->findPointDonor(pt_ptr);
@@ -393,25 +473,159 @@ void overComm::matchOversetPoints(vector<shared_ptr<ele>> &eles, const vector<in
           foundEles[p].push_back(ic); // Local ele id for this grid
           foundLocs[p].push_back(refLoc);
           if (params->oversetMethod==1)
-            foundNorm[p].push_back(point(&interpNorms[3*(offset+i)]));
+            foundNorm[p].push_back(point(norm_ptr));
         }
       }
 
     }
+
+    if (candPt.empty()) continue;
+
+    vector<point> candLoc;
+    vector<char> candFound;
+    ele::getRefLocNewtonBatch(eles,candEle,candPos,candLoc,candFound,candStart);
+
+    // Each point takes the first candidate cell [in ADT order] which contains it
+    for (int k=0; k<candPt.size(); k++) {
+      if (!candFound[k]) continue;
+
+      int j = candPt[k];
+
+      int ic = candCell[k];
+      point refLoc = candLoc[k];
+      foundPts[p].push_back(ptIdsRecv[p][j]);
+      foundEles[p].push_back(ic); // Local ele id for this grid
+      foundLocs[p].push_back(refLoc);
+      if (params->oversetMethod==1) {
+        foundNorm[p].push_back(point(&ptsRecv[p](j,3)));
+        if (!params->motion) {
+          matrix<double> jacobian, invJaco;
+          double detJac;
+          eles[candEle[k]]->calcTransforms_point(jacobian,invJaco,detJac,refLoc);
+          foundJaco[p].push_back(jacobian);
+          foundDetJac[p].push_back(detJac);
+        }
+      }
+    }
   }
 
   /* ---- Prepare for Data Communication ---- */
 
+  setupOversetComm();
+#endif
+}
+
+void overComm::setupOversetComm(void)
+{
+#ifndef _NO_MPI
   // Get the number of matched points for each grid
-  nPtsSend.resize(nproc);
+  nPtsSend.assign(nproc,0);
   for (int p=0; p<nproc; p++) {
     if (gridIdList[p] == gridID) continue;
     nPtsSend[p] = foundPts[p].size();
   }
+
+  setupNPieces(nPtsSend,nPtsRecv);
+
+  if (nOverPts > getSum(nPtsRecv)) {
+    cout << "rank " << params->rank << ", # Unmatched Points = " << nOverPts - getSum(nPtsRecv) << " out of " << nOverPts << endl;
+    FatalError("Unmatched points remaining!");
+  }
+
+  /* ---- The receiving ranks only need the point IDs once per match ---- */
+
+  recvPts.assign(nproc,vector<int>());
+  vector<MPI_Request> requests;
+  for (int p=0; p<nproc; p++) {
+    if (p==rank) continue;
+    if (nPtsRecv[p]>0) {
+      recvPts[p].resize(nPtsRecv[p]);
+      requests.emplace_back();
+      MPI_Irecv(recvPts[p].data(),nPtsRecv[p],MPI_INT,p,p,interComm,&requests.back());
+    }
+    if (nPtsSend[p]>0) {
+      requests.emplace_back();
+      MPI_Isend(foundPts[p].data(),nPtsSend[p],MPI_INT,p,rank,interComm,&requests.back());
+    }
+  }
+  MPI_Waitall(requests.size(),requests.data(),MPI_STATUSES_IGNORE);
+
+  /* ---- Persistent requests for the solution [& gradient] data ---- */
+
+  recvOversetData();
+  recvOversetGradient();
+
+  for (auto &req:U_requests) MPI_Request_free(&req);
+  for (auto &req:gradU_requests) MPI_Request_free(&req);
+  U_requests.clear();
+  gradU_requests.clear();
+
+  // For flux-interp method, send both solution and normal flux
+  int nVars = nFields;
+  if (params->oversetMethod == 1) nVars *= 2;
+  int nGradVars = nDims*nFields;
+
+  U_out.resize(nproc);
+  U_recv.resize(nproc);
+  gradU_out.resize(nproc);
+  gradU_recv.resize(nproc);
+  U_in.setup(getSum(nPtsRecv),nVars);
+  if (params->viscous)
+    gradU_in.setup(getSum(nPtsRecv),nGradVars);
+
+  // The gradient messages go over their own communicator, apart from the solution messages
+  for (int p=0; p<nproc; p++) {
+    if (p==rank) continue;
+
+    U_out[p].setup(nPtsSend[p],nVars);
+    U_recv[p].setup(nPtsRecv[p],nVars);
+    if (nPtsRecv[p]>0) {
+      U_requests.emplace_back();
+      MPI_Recv_init(U_recv[p].getData(),nPtsRecv[p]*nVars,MPI_DOUBLE,p,p,interComm,&U_requests.back());
+    }
+    if (nPtsSend[p]>0) {
+      U_requests.emplace_back();
+      MPI_Send_init(U_out[p].getData(),nPtsSend[p]*nVars,MPI_DOUBLE,p,rank,interComm,&U_requests.back());
+    }
+
+    if (!params->viscous) continue;
+
+    gradU_out[p].setup(nPtsSend[p],nGradVars);
+    gradU_recv[p].setup(nPtsRecv[p],nGradVars);
+    if (nPtsRecv[p]>0) {
+      gradU_requests.emplace_back();
+      MPI_Recv_init(gradU_recv[p].getData(),nPtsRecv[p]*nGradVars,MPI_DOUBLE,p,p,gradComm,&gradU_requests.back());
+    }
+    if (nPtsSend[p]>0) {
+      gradU_requests.emplace_back();
+      MPI_Send_init(gradU_out[p].getData(),nPtsSend[p]*nGradVars,MPI_DOUBLE,p,rank,gradComm,&gradU_requests.back());
+    }
+  }
 #endif
 }
 
 
+int overComm::findDonorNear(vector<shared_ptr<ele>> &eles, const vector<int> &eleMap, int ic0, const point &pt, point &loc)
+{
+  int ie0 = eleMap[ic0];
+  if (ie0 < 0) return -1;
+
+  // Cells which have since become fringe [receptor] cells can't donate
+  geo *Geo = eles[ie0]->Geo;
+  if (Geo->iblankCell[ic0] == NORMAL && eles[ie0]->getRefLocNewton(pt,loc,true))
+    return ic0;
+
+  for (int j=0; j<Geo->c2nf[ic0]; j++) {
+    int ic = Geo->c2c(ic0,j);
+    if (ic < 0 || eleMap[ic] < 0 || Geo->iblankCell[ic] != NORMAL) continue;
+
+    if (eles[eleMap[ic]]->getRefLocNewton(pt,loc))
+      return ic;
+  }
+
+  return -1;
+}
+
 void overComm::matchUnblankCells(vector<shared_ptr<ele>> &eles, unordered_set<int>& unblankCells, vector<int> &eleMap, int quadOrder)
 {
 #ifndef _NO_MPI
@@ -466,7 +680,8 @@ void overComm::matchUnblankCells(vector<shared_ptr<ele>> &eles, unordered_set<in
   foundCells.resize(nproc);
   foundCellDonors.resize(nproc);
   foundCellNDonors.resize(nproc);
-  donors.resize(0);
+  vector<vector<point>> targetList;
+  vector<Array2D<point>> donorList;
   int offset = 0;
   for (int p=0; p<nproc; p++) {
     if (p>0) offset += nCells_rank[p-1];
@@ -540,18 +755,17 @@ void overComm::matchUnblankCells(vector<shared_ptr<ele>> &eles, unordered_set<in
           }
         }
 
-        superMesh mesh(targetNodes,donorPts,quadOrder,nDims,rank,donors.size());
-        donors.push_back(mesh);
+        targetList.push_back(targetNodes);
+        donorList.push_back(donorPts);
       }
     }
   }
 
   /* --- Setup & Exchange Quadrature-Point Data --- */
 
-  // Now that we have the local superMesh for each target, setup points for
-  // use with Galerkin projection
-  for (auto &mesh:donors)
-    mesh.setupQuadrature();
+  // Build the local superMesh for each target, and setup points for use with
+  // Galerkin projection [in parallel over targets]
+  buildSuperMeshes(donors,targetList,donorList,quadOrder,nDims,rank);
 #endif
 }
 
@@ -581,6 +795,10 @@ void overComm::performGalerkinProjection(vector<shared_ptr<ele>> &eles, map<int,
     targetID[p].resize(0);
     donorBasis[p].setup(0,0);
 
+    // Quadrature points & their donor eles, to be inverted as one batch
+    vector<point> qptPos;
+    vector<int> qptEle;
+
     for (int i=0; i<foundCells[p].size(); i++) {
       vector<int> parents_tmp;
       matrix<double> qpts_tmp;
@@ -590,23 +808,8 @@ void overComm::performGalerkinProjection(vector<shared_ptr<ele>> &eles, map<int,
         qpts[p].insertRow(qpts_tmp[j],INSERT_AT_END,3);
         donorID[p].push_back(foundCellDonors[p](i,parents_tmp[j]));
         targetID[p].push_back(foundCells[p][i]);
-        int ic = eleMap[donorID[p].back()];
-        point refLoc;
-        bool isInEle;
-
-        isInEle = eles[ic]->getRefLocNewton(point(qpts_tmp[j],nDims),refLoc);
-
-        if (!isInEle) {
-          _(point(qpts_tmp[j]));
-          FatalError("Quadrature Point Reference Location not found in ele!"
-                     "\nAre you using non-linear shape funcs perhaps?");
-        }
-
-        qptsD_ref[p].insertRow({refLoc.x,refLoc.x,refLoc.z});
-
-        vector<double> basisTmp;
-        opers[eles[ic]->order].getBasisValues(refLoc,basisTmp);
-        donorBasis[p].insertRow(basisTmp);
+        qptPos.push_back(point(qpts_tmp[j],nDims));
+        qptEle.push_back(eleMap[donorID[p].back()]);
       }
 
       for (int id=0; id<foundCellNDonors[p][i]; id++) {
@@ -619,6 +822,25 @@ void overComm::performGalerkinProjection(vector<shared_ptr<ele>> &eles, map<int,
         }
       }
     }
+
+    vector<point> qptLoc;
+    vector<char> isInEle;
+    ele::getRefLocNewtonBatch(eles,qptEle,qptPos,qptLoc,isInEle);
+
+    for (int j=0; j<qptPos.size(); j++) {
+      if (!isInEle[j]) {
+        _(qptPos[j]);
+        FatalError("Quadrature Point Reference Location not found in ele!"
+                   "\nAre you using non-linear shape funcs perhaps?");
+      }
+
+      point refLoc = qptLoc[j];
+      qptsD_ref[p].insertRow({refLoc.x,refLoc.x,refLoc.z});
+
+      vector<double> basisTmp;
+      opers[eles[qptEle[j]]->order].getBasisValues(refLoc,basisTmp);
+      donorBasis[p].insertRow(basisTmp);
+    }
   }
 
   // Exchange superMesh quadrature points among the grids
@@ -753,21 +975,79 @@ void overComm::performGalerkinProjection(vector<shared_ptr<ele>> &eles, map<int,
     }
   }
 
-  // Apply the new values to the unblank ele objects
+  /* --- Factor each target cell's mass matrix.  A cached factor is only reused
+   * if the freshly-assembled matrix is the one it was computed from, so the LHS
+   * stays consistent with this step's supermesh & RHS quadrature.  Only cells
+   * fully covered by their supermesh on rigidly-moving grids are cached --- */
+  bool rigid = isRigidMotion(params,gridID);
+  if (!rigid) massFactors.clear();
+
+  auto sameMatrix = [](matrix<double> &A, matrix<double> &B) {
+    double maxA = 0, maxDiff = 0;
+    for (uint j=0; j<A.getDim0(); j++) {
+      for (uint k=0; k<A.getDim1(); k++) {
+        maxA = max(maxA, fabs(A(j,k)));
+        maxDiff = max(maxDiff, fabs(A(j,k)-B(j,k)));
+      }
+    }
+    return maxDiff <= 1e-10*maxA;
+  };
+
+  auto wts = getQptWeights(order,nDims);
+  vector<char> needFactor(nUnblanks,1), cacheFactor(nUnblanks,0);
   for (int i=0; i<nUnblanks; i++) {
     int ic = ubCells[i];
-    for (int spt=0; spt<nSpts; spt++)
-      for (int k=0; k<nFields; k++)
-        eles[ic]->U_spts(spt,k) = 0;
+    auto it = massFactors.find(eles[ic]->ID);
+    if (it != massFactors.end()) {
+      if (sameMatrix(it->second.first,ubLHS[i])) {
+        ubLHS[i] = it->second.second;
+        needFactor[i] = 0;
+        continue;
+      }
+      massFactors.erase(it);
+    }
+
+    if (!rigid) continue;
 
-    auto unblankU = solveCholesky(ubLHS[i],ubRHS[i]);
+    // The nodal basis sums to 1, so the entries of the mass matrix sum to the
+    // volume covered by the supermesh
+    double volSM = 0, vol = 0;
+    for (int j=0; j<nSpts; j++)
+      for (int k=0; k<nSpts; k++)
+        volSM += ubLHS[i](j,k);
     for (int spt=0; spt<nSpts; spt++)
-      for (int k=0; k<nFields; k++)
-        eles[ic]->U_spts(spt,k) += unblankU(spt,k);
+      vol += eles[ic]->detJac_spts(spt) * wts[spt];
+
+    if (fabs(volSM-vol) <= 1e-10*fabs(vol)) {
+      cacheFactor[i] = 1;
+      massFactors[eles[ic]->ID].first = ubLHS[i];
+    }
   }
+
+#pragma omp parallel for
+  for (int i=0; i<nUnblanks; i++)
+    if (needFactor[i]) choleskyFactor(ubLHS[i]);
+
+  for (int i=0; i<nUnblanks; i++)
+    if (cacheFactor[i]) massFactors[eles[ubCells[i]]->ID].second = ubLHS[i];
+
+  applyProjection(eles,ubRHS);
 #endif
 }
 
+void overComm::applyProjection(vector<shared_ptr<ele>> &eles, vector<matrix<double>> &ubRHS)
+{
+  // Apply the new values to the unblank ele objects
+#pragma omp parallel for
+  for (int i=0; i<nUnblanks; i++) {
+    int ic = ubCells[i];
+    choleskySolve(ubLHS[i],ubRHS[i]);
+    for (int spt=0; spt<eles[ic]->nSpts; spt++)
+      for (int k=0; k<nFields; k++)
+        eles[ic]->U_spts(spt,k) = ubRHS[i](spt,k);
+  }
+}
+
 void overComm::performProjection_static(vector<shared_ptr<ele>> &eles, vector<int> &eleMap, int order)
 {
 #ifndef _NO_MPI
@@ -841,18 +1121,8 @@ void overComm::performProjection_static(vector<shared_ptr<ele>> &eles, vector<in
     }
   }
 
-  // Apply the new values to the unblank ele objects
-  for (int i=0; i<nUnblanks; i++) {
-    int ic = ubCells[i];
-    for (int spt=0; spt<nSpts; spt++)
-      for (int k=0; k<nFields; k++)
-        eles[ic]->U_spts(spt,k) = 0;
-
-    auto unblankU = solveCholesky(ubLHS[i],ubRHS[i]);
-    for (int spt=0; spt<nSpts; spt++)
-      for (int k=0; k<nFields; k++)
-        eles[ic]->U_spts(spt,k) += unblankU(spt,k);
-  }
+  // ubLHS already holds the factored mass matrices from performGalerkinProjection
+  applyProjection(eles,ubRHS);
 #endif
 }
 
@@ -905,7 +1175,8 @@ vector<double> overComm::integrateErrOverset(vector<shared_ptr<ele>> &eles, map<
   vector<vector<int>> foundCells(nproc); //.resize(nproc);
   vector<matrix<int>> foundCellDonors(nproc);
   vector<vector<int>> foundCellNDonors(nproc);
-  vector<superMesh> supers(0);
+  vector<vector<point>> targetList;
+  vector<Array2D<point>> donorList;
   int offset = 0;
   for (int p=0; p<nproc; p++) {
     if (p>0) offset += nCells_rank[p-1];
@@ -977,18 +1248,18 @@ vector<double> overComm::integrateErrOverset(vector<shared_ptr<ele>> &eles, map<
           }
         }
 
-        superMesh mesh(targetNodes,donorPts,quadOrder,nDims,rank,supers.size());
-        supers.push_back(mesh);
+        targetList.push_back(targetNodes);
+        donorList.push_back(donorPts);
       }
     }
   }
 
   /* --- Setup & Exchange Quadrature-Point Data --- */
 
-  // Now that we have the local superMesh for each target, setup points for
-  // use with numerical quadrature
-  for (auto &mesh:supers)
-    mesh.setupQuadrature();
+  // Build the local superMesh for each target, and setup points for use with
+  // numerical quadrature [in parallel over targets]
+  vector<superMesh> supers;
+  buildSuperMeshes(supers,targetList,donorList,quadOrder,nDims,rank);
 
   // Get the locations of the quadrature points for each target cell, and
   // interpolate the solution error to them
@@ -1133,17 +1404,92 @@ vector<double> overComm::integrateErrOverset(vector<shared_ptr<ele>> &eles, map<
 #endif
 }
 
+void overComm::setupInterpMatrix(vector<shared_ptr<ele>> &eles, map<int, oper> &opers, vector<int> &eleMap)
+{
+#ifndef _NO_MPI
+  interpPtr.assign(nproc,vector<int>(1,0));
+  interpInd.assign(nproc,vector<size_t>());
+  interpWts.assign(nproc,vector<double>());
+
+  // Offsets from the start of the solver's U_spts array are never negative,
+  // whatever order eles is in
+  const double *U_base = (eles.size() > 0) ? &eles[0]->Solver->U_spts(0,0,0) : NULL;
+
+  for (int p=0; p<nproc; p++) {
+    if (gridIdList[p] == gridID) continue;
+
+    for (int i=0; i<nPtsSend[p]; i++) {
+      int ic = eleMap[foundEles[p][i]];
+
+      if (ic<0 || ic>eles.size())
+        FatalError("bad value of ic!");
+
+      vector<double> weights;
+      opers[eles[ic]->order].getBasisValues(foundLocs[p][i],weights);
+
+      for (int spt=0; spt<eles[ic]->nSpts; spt++) {
+        if (weights[spt] == 0) continue;
+        interpInd[p].push_back(&eles[ic]->U_spts(spt,0) - U_base);
+        interpWts[p].push_back(weights[spt]);
+      }
+      interpPtr[p].push_back(interpInd[p].size());
+    }
+  }
+
+  haveInterpMatrix = true;
+#endif
+}
+
 void overComm::exchangeOversetData(vector<shared_ptr<ele>> &eles, map<int, oper> &opers, vector<int> &eleMap)
+{
+  sendOversetData(eles,opers,eleMap);
+  recvOversetData();
+}
+
+void overComm::sendOversetData(vector<shared_ptr<ele>> &eles, map<int, oper> &opers, vector<int> &eleMap)
 {
 #ifndef _NO_MPI
-  U_out.resize(nproc);
+  // The send buffers can't be touched until any previous exchange is complete
+  recvOversetData();
+
+  if (!params->motion && params->oversetMethod != 1) {
+    /* ---- Static grids: one sparse mat-vec per destination rank ---- */
+
+    if (!haveInterpMatrix)
+      setupInterpMatrix(eles,opers,eleMap);
+
+    const double *U_base = (eles.size() > 0) ? &eles[0]->Solver->U_spts(0,0,0) : NULL;
+
+    for (int p=0; p<nproc; p++) {
+      if (gridIdList[p] == gridID) continue;
+
+      const int *ptr = interpPtr[p].data();
+      const size_t *ind = interpInd[p].data();
+      const double *wts = interpWts[p].data();
+
+#pragma omp parallel for
+      for (int i=0; i<nPtsSend[p]; i++) {
+        double *U = U_out[p][i];
+        for (int k=0; k<nFields; k++)
+          U[k] = 0;
+
+        for (int j=ptr[i]; j<ptr[i+1]; j++) {
+          const double *U_spt = U_base + ind[j];
+          for (int k=0; k<nFields; k++)
+            U[k] += wts[j] * U_spt[k];
+        }
+      }
+    }
+
+    // [MPI_Startall may reject an empty request array]
+    if (!U_requests.empty())
+      MPI_Startall(U_requests.size(),U_requests.data());
+    dataPending = true;
+    return;
+  }
+
   unordered_set<int> correctedEles;
   for (int p=0; p<nproc; p++) {
-    if (params->oversetMethod == 1)
-      U_out[p].setup(foundPts[p].size(),2*nFields);
-    else
-      U_out[p].setup(foundPts[p].size(),nFields);
-
     if (gridIdList[p] == gridID) continue;
     for (int i=0; i<foundPts[p].size(); i++) {
       point refPos = foundLocs[p][i];
@@ -1289,43 +1635,50 @@ void overComm::exchangeOversetData(vector<shared_ptr<ele>> &eles, map<int, oper>
     }
   }
 
-  /* ---- Send/Receive the the interpolated data across grids using interComm ---- */
-  nPtsSend.assign(nproc,0);
-  for (int p=0; p<nproc; p++) {
-    if (gridIdList[p] == gridID) continue;
-    nPtsSend[p] = foundPts[p].size();
-  }
+  /* ---- Start sending the interpolated data across grids using interComm ---- */
+  if (!U_requests.empty())
+    MPI_Startall(U_requests.size(),U_requests.data());
+  dataPending = true;
+#endif
+}
 
-  setupNPieces(nPtsSend,nPtsRecv);
+void overComm::recvOversetData(void)
+{
+#ifndef _NO_MPI
+  if (!dataPending) return;
 
-  if (nOverPts > getSum(nPtsRecv)) {
-    cout << "rank " << params->rank << ", # Unmatched Points = " << nOverPts - getSum(nPtsRecv) << " out of " << nOverPts << endl;
-    FatalError("Unmatched points remaining!");
-  }
+  double t0 = MPI_Wtime();
+  MPI_Waitall(U_requests.size(),U_requests.data(),MPI_STATUSES_IGNORE);
+  waitTime += MPI_Wtime() - t0;
+  dataPending = false;
 
-  recvPts.resize(nproc);
+  // Rearrange data into final storage matrix
+  int nVars = U_in.getDim1();
   for (int p=0; p<nproc; p++) {
     if (p==rank) continue;
-    recvPts[p].resize(nPtsRecv[p]);
+    for (int i=0; i<nPtsRecv[p]; i++)
+      for (int k=0; k<nVars; k++)
+        U_in(recvPts[p][i],k) = U_recv[p](i,k);
   }
-
-  // For flux-interp method, send both solution and normal flux
-  int nVars = nFields;
-  if (params->oversetMethod == 1) nVars *= 2;
-
-  sendRecvData(nPtsSend,nPtsRecv,foundPts,recvPts,U_out,U_in,nVars,true);
 #endif
 }
 
 void overComm::exchangeOversetGradient(vector<shared_ptr<ele>> &eles, map<int, oper> &opers, vector<int> &eleMap)
+{
+  sendOversetGradient(eles,opers,eleMap);
+  recvOversetGradient();
+}
+
+void overComm::sendOversetGradient(vector<shared_ptr<ele>> &eles, map<int, oper> &opers, vector<int> &eleMap)
 {
 #ifndef _NO_MPI
-  gradU_out.resize(nproc);
+  recvOversetGradient();
 
   for (int p=0; p<nproc; p++) {
-    gradU_out[p].setup(foundPts[p].size(),nDims*nFields);
     if (gridIdList[p] == gridID) continue;
 
+    gradU_out[p].initializeToZero();
+
     for (int i=0; i<foundPts[p].size(); i++) {
       point refPos = foundLocs[p][i];
       int ic = eleMap[foundEles[p][i]];
@@ -1338,11 +1691,11 @@ void overComm::exchangeOversetGradient(vector<shared_ptr<ele>> &eles, map<int, o
       //   transform as required.
       vector<matrix<double>> tempDU_spts;
       uint nSpts = eles[ic]->nSpts;
-      uint nFpts = eles[ic]->nFpts;
       if (params->motion) {
         // Gradient vector must be in ref. space in order to apply correction functions
         tempDU_spts = eles[ic]->transformGradU_physToRef();
       } else {
+        tempDU_spts.assign(nDims,matrix<double>(nSpts,nFields));
         for (uint dim = 0; dim < params->nDims; dim++)
           for (uint spt = 0; spt < nSpts; spt++)
             for (uint k = 0; k < params->nFields; k++)
@@ -1366,27 +1719,31 @@ void overComm::exchangeOversetGradient(vector<shared_ptr<ele>> &eles, map<int, o
     }
   }
 
-  /* ---- Send/Receive the the interpolated data across grids using interComm ---- */
-  nPtsSend.assign(nproc,0);
-  for (int p=0; p<nproc; p++) {
-    if (gridIdList[p] == gridID) continue;
-    nPtsSend[p] = foundPts[p].size();
-  }
+  /* ---- Start sending the interpolated gradient across grids using gradComm ---- */
+  if (!gradU_requests.empty())
+    MPI_Startall(gradU_requests.size(),gradU_requests.data());
+  gradPending = true;
+#endif
+}
 
-  setupNPieces(nPtsSend,nPtsRecv);
+void overComm::recvOversetGradient(void)
+{
+#ifndef _NO_MPI
+  if (!gradPending) return;
 
-  if (nOverPts > getSum(nPtsRecv)) {
-    cout << "rank " << params->rank << ", # Unmatched Points = " << nOverPts - getSum(nPtsRecv) << " out of " << nOverPts << endl;
-    FatalError("Unmatched points remaining!");
-  }
+  double t0 = MPI_Wtime();
+  MPI_Waitall(gradU_requests.size(),gradU_requests.data(),MPI_STATUSES_IGNORE);
+  waitTime += MPI_Wtime() - t0;
+  gradPending = false;
 
-  recvPts.assign(nproc,{0});
+  // Rearrange data into final storage matrix
+  int nGradVars = gradU_in.getDim1();
   for (int p=0; p<nproc; p++) {
     if (p==rank) continue;
-    recvPts[p].resize(nPtsRecv[p]);
+    for (int i=0; i<nPtsRecv[p]; i++)
+      for (int k=0; k<nGradVars; k++)
+        gradU_in(recvPts[p][i],k) = gradU_recv[p](i,k);
   }
-
-  sendRecvData(nPtsSend,nPtsRecv,foundPts,recvPts,gradU_out,gradU_in,nDims*nFields,true);
 #endif
 }
 
@@ -1442,7 +1799,7 @@ void overComm::setupNPieces(vector<int> &nPiecesIn, vector<int> &nPiecesOut)
 
 template<typename T>
 void overComm::sendRecvData(vector<int> &nPiecesSend, vector<int> &nPiecesRecv, vector<vector<int>> &sendInds, vector<vector<int>> &recvInds,
-                            vector<matrix<T>> &sendVals, matrix<T> &recvVals, int stride, bool matchInds=false)
+                            vector<matrix<T>> &sendVals, matrix<T> &recvVals, int stride, bool matchInds)
 {
   // Do basic send/receive, keeping receive values in destination arrays from each rank
   vector<matrix<T>> tmpRecvVals;
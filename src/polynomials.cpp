@@ -175,6 +175,24 @@ double Legendre2D_hierarchical(int in_mode, vector<double> in_loc, int in_basis_
   return leg_basis;
 }
 
+vector<array<int,3>> getModeIndices(int nDims, int order)
+{
+  vector<array<int,3>> modes;
+
+  int kMax = (nDims == 3) ? order : 0;
+  for (int s = 0; s <= nDims*order; s++) {
+    for (int k = 0; k <= kMax; k++) {
+      for (int j = 0; j <= order; j++) {
+        int i = s - j - k;
+        if (i >= 0 && i <= order)
+          modes.push_back({{i, j, k}});
+      }
+    }
+  }
+
+  return modes;
+}
+
 double exponential_filter(int in_mode, int inBasisOrder, double exponent)
 {
   double sigma = 0;
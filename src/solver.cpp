@@ -47,6 +47,9 @@ class boundFace;
 #include "intFace.hpp"
 #include "boundFace.hpp"
 
+//! Number of element blocks [and face chunks] per OpenMP thread in calcResidual_tasks
+#define N_TASKS_PER_THREAD 4
+
 solver::solver()
 {
 
@@ -102,6 +105,8 @@ void solver::setup(input *params, int _order, geo *_Geo)
 
   setupArrays();
 
+  setupKernels();
+
   setupGeometry();
 
   setupElesFaces();
@@ -112,6 +117,12 @@ void solver::setup(input *params, int _order, geo *_Geo)
 #ifndef _NO_MPI
   finishMpiSetup();
 #endif
+
+  setupTaskGraph();
+
+  setupProbes();
+
+  calcWallDistance();
 }
 
 void solver::setupArrays(void)
@@ -160,6 +171,23 @@ void solver::setupArrays(void)
 
   tempVars_spts.setup(nSpts, nEles, nFields);
   tempVars_fpts.setup(nFpts, nEles, nFields);
+
+  /* Running statistics of the primitives */
+  if (params->calcStats)
+  {
+    nStats = 2*nFields;
+    if (params->equation == NAVIER_STOKES)
+      nStats += nDims*(nDims-1)/2;
+    stats_spts.setup(nSpts, nEles, nStats);
+    stats_ppts.setup(nPpts, nEles, nStats);
+  }
+
+  /* Wave speed over each element face [quads/hexes] for CFL-based time step */
+  if (params->dtType != 0)
+  {
+    int nFacesEle = (nDims == 2) ? 4 : 6;
+    waveSp_faces.setup(nEles, nFacesEle);
+  }
 }
 
 void solver::setupGeometry(void)
@@ -318,6 +346,8 @@ void solver::setupGeometry(void)
 
 void solver::update(bool PMG_Source)
 {
+  auto t0 = std::chrono::high_resolution_clock::now();
+
   /* Intermediate residuals for Runge-Kutta time integration */
 
   for (int step=0; step<nRKSteps-1; step++) {
@@ -360,12 +390,25 @@ void solver::update(bool PMG_Source)
   }
 
   params->time += params->dt;
+
+  auto t1 = std::chrono::high_resolution_clock::now();
+  updateTime += std::chrono::duration<double>(t1 - t0).count();
 }
 
 
 void solver::calcResidual(int step)
 {
-  if (nEles == 0) return;
+  if (nEles == 0) {
+    // Still take part in the time-step reduction [dtLocal = INFINITY]
+    if (params->dtType != 0 && step == nRKSteps-1)
+      calcDt_faces();
+    return;
+  }
+
+  if (useTasks) {
+    calcResidual_tasks(step);
+    return;
+  }
 
   if (params->meshType == OVERSET_MESH && params->oversetMethod == 2) {
     oversetFieldInterp();
@@ -396,6 +439,12 @@ void solver::calcResidual(int step)
   doCommunication();
 #endif
 
+  /* --- The interpolated solution only needs U_spts, so the overset exchange
+   * overlaps with the interior flux computation; the flux-interpolation
+   * method must wait for the common flux at the donor faces --- */
+  if (params->meshType == OVERSET_MESH && params->oversetMethod != 1)
+    oversetInterp();
+
   calcInviscidFlux_spts();
 
   calcInviscidFlux_faces();
@@ -406,12 +455,18 @@ void solver::calcResidual(int step)
 
   if (params->meshType == OVERSET_MESH) {
 
-    oversetInterp();
+    if (params->oversetMethod == 1)
+      oversetInterp();
 
     calcInviscidFlux_overset();
 
   }
 
+  /* --- Wave speeds at all faces are now set; the time step for the next
+   * iteration is reduced while the rest of the residual is computed --- */
+  if (params->dtType != 0 && step == nRKSteps-1)
+    calcDt_faces();
+
   if (params->viscous) {
 
     correctGradU();
@@ -422,6 +477,9 @@ void solver::calcResidual(int step)
     doCommunicationGrad();
 #endif
 
+    if (params->meshType == OVERSET_MESH)
+      oversetInterp_gradient();
+
     calcViscousFlux_spts();
 
     calcViscousFlux_faces();
@@ -430,11 +488,8 @@ void solver::calcResidual(int step)
     calcViscousFlux_mpi();
 #endif
 
-    if (params->meshType == OVERSET_MESH) {
-      oversetInterp_gradient();
-
+    if (params->meshType == OVERSET_MESH)
       calcViscousFlux_overset();
-    }
   }
 
   extrapolateNormalFlux();
@@ -444,14 +499,163 @@ void solver::calcResidual(int step)
   correctDivFlux(step);
 }
 
+void solver::calcResidual_tasks(int step)
+{
+  int nBlocks = eleBlocks.size();
+  int nChunks = faceChunks.size();
+
+  char *tU = depU.data();    // Solution at fpts
+  char *tDU = depDU.data();  // Solution gradient at spts & fpts
+  char *tF = depF.data();    // Flux at spts
+  char *tFn = depFn.data();  // Common flux [& solution] at a chunk's faces
+
+  /* --- One task-generating thread; the rest of the team executes tasks as
+   * their dependencies are satisfied.  MPI calls are made only by the master
+   * thread, overlapping with the tasks already generated. --- */
+
+#pragma omp parallel
+#pragma omp master
+  {
+    /* --- Solution [& gradient] at the fpts, and inviscid flux at the spts --- */
+
+    for (int b = 0; b < nBlocks; b++) {
+      uint e0 = eleBlocks[b][0], e1 = eleBlocks[b][1];
+
+#pragma omp task depend(out: tU[b])
+      extrapolateU(e0, e1);
+
+      if (params->viscous) {
+#pragma omp task depend(out: tDU[b])
+        calcGradU_spts(e0, e1);
+      }
+
+#pragma omp task depend(out: tF[b])
+      calcInviscidFlux_spts(e0, e1);
+    }
+
+#ifndef _NO_MPI
+    if (mpiFaces.size() > 0) {
+#pragma omp taskwait depend(iterator(b=0:nBlocks), in: tU[b])
+      doCommunication();
+    }
+#endif
+
+    /* --- Inviscid interface fluxes --- */
+
+    for (int c = 0; c < nChunks; c++) {
+      uint f0 = faceChunks[c][0], f1 = faceChunks[c][1];
+      int *blocks = chunkBlocks[c].data();
+      int nb = chunkBlocks[c].size();
+
+#pragma omp task depend(iterator(j=0:nb), in: tU[blocks[j]]) depend(out: tFn[c])
+      calcInviscidFlux_faces(f0, f1);
+    }
+
+#ifndef _NO_MPI
+    calcInviscidFlux_mpi();
+#endif
+
+    if (params->viscous) {
+
+      /* --- Corrected gradient, once the common solution at all of a block's
+       * faces is available --- */
+
+      for (int b = 0; b < nBlocks; b++) {
+        uint e0 = eleBlocks[b][0], e1 = eleBlocks[b][1];
+        int *chunks = blockChunks[b].data();
+        int nc = blockChunks[b].size();
+
+#pragma omp task depend(iterator(j=0:nc), in: tFn[chunks[j]]) depend(inout: tDU[b])
+        {
+          correctGradU(e0, e1);
+          extrapolateGradU(e0, e1);
+        }
+      }
+
+#ifndef _NO_MPI
+      if (mpiFaces.size() > 0) {
+#pragma omp taskwait depend(iterator(b=0:nBlocks), in: tDU[b])
+        doCommunicationGrad();
+      }
+#endif
+
+      /* --- Viscous fluxes --- */
+
+      for (int b = 0; b < nBlocks; b++) {
+        uint e0 = eleBlocks[b][0], e1 = eleBlocks[b][1];
+
+#pragma omp task depend(in: tDU[b]) depend(inout: tF[b])
+        calcViscousFlux_spts(e0, e1);
+      }
+
+      for (int c = 0; c < nChunks; c++) {
+        uint f0 = faceChunks[c][0], f1 = faceChunks[c][1];
+        int *blocks = chunkBlocks[c].data();
+        int nb = chunkBlocks[c].size();
+
+#pragma omp task depend(iterator(j=0:nb), in: tDU[blocks[j]]) depend(inout: tFn[c])
+        calcViscousFlux_faces(f0, f1);
+      }
+
+#ifndef _NO_MPI
+      calcViscousFlux_mpi();
+#endif
+    }
+
+    /* --- Divergence of the flux; correction once all of a block's faces are done --- */
+
+    for (int b = 0; b < nBlocks; b++) {
+      uint e0 = eleBlocks[b][0], e1 = eleBlocks[b][1];
+      int *chunks = blockChunks[b].data();
+      int nc = blockChunks[b].size();
+
+#pragma omp task depend(inout: tF[b])
+      {
+        extrapolateNormalFlux(e0, e1);
+        calcDivF_spts(step, e0, e1);
+      }
+
+#pragma omp task depend(in: tF[b]) depend(iterator(j=0:nc), in: tFn[chunks[j]])
+      correctDivFlux(step, e0, e1);
+    }
+
+    if (params->dtType != 0 && step == nRKSteps-1) {
+#pragma omp taskwait depend(iterator(c=0:nChunks), in: tFn[c])
+      calcDt_faces();
+    }
+  }
+}
+
 void solver::calcDt(void)
 {
-  if (params->iter == params->initIter+1) {
+  /* --- Use the time step found during the last flux evaluation --- */
+  if (dtPending) {
+#ifndef _NO_MPI
+    double t0 = MPI_Wtime();
+    MPI_Wait(&dtRequest, MPI_STATUS_IGNORE);
+    waitTime += MPI_Wtime() - t0;
+#else
+    dtGlobal = dtLocal;
+#endif
+    dtPending = false;
+
+    params->dt = dtGlobal;
+
+    if (params->dtType == 2) {
 #pragma omp parallel for
-    for (uint i = 0; i < nEles; i++)
-      eles[i]->calcWaveSpFpts();
+      for (uint i = 0; i < nEles; i++)
+        eles[i]->dt = eles[i]->dtNext;
+    }
+    return;
   }
 
+  /* --- No face fluxes computed yet [first iteration] - get wave speeds
+   * from the current solution --- */
+
+#pragma omp parallel for
+  for (uint i = 0; i < nEles; i++)
+    eles[i]->calcWaveSpFpts();
+
   double dt = INFINITY;
 
 #pragma omp parallel for reduction(min:dt)
@@ -467,6 +671,47 @@ void solver::calcDt(void)
   params->dt = dt;
 }
 
+void solver::calcDt_faces(void)
+{
+  // Finish any reduction left over from a residual evaluation outside update()
+  if (dtPending) {
+#ifndef _NO_MPI
+    MPI_Wait(&dtRequest, MPI_STATUS_IGNORE);
+#endif
+    dtPending = false;
+  }
+
+  /* --- dt = CFL * CFLLimit * 2 * vol / (integral of wave speed over
+   * element surface); find the largest inverse --- */
+
+  double cflFac = params->CFL * getCFLLimit(order) * 2;
+  uint nFacesEle = waveSp_faces.getDim1();
+
+  double maxRate = 0;
+
+#pragma omp parallel for reduction(max:maxRate)
+  for (uint e = 0; e < nEles; e++) {
+    double intWave = 0;
+    for (uint f = 0; f < nFacesEle; f++)
+      intWave += waveSp_faces(e,f);
+
+    double rate = intWave / (cflFac * vol_eles[e]);
+    maxRate = max(maxRate, rate);
+
+    // Applied at the next calcDt, so every stage of this step uses the same dt
+    if (params->dtType == 2)
+      eles[e]->dtNext = 1. / rate;
+  }
+
+  dtLocal = (maxRate > 0) ? 1. / maxRate : INFINITY;
+
+#ifndef _NO_MPI
+  MPI_Iallreduce(&dtLocal, &dtGlobal, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD, &dtRequest);
+#endif
+
+  dtPending = true;
+}
+
 void solver::timeStepA(int step, double RKval, bool PMG_Source)
 {
   if (PMG_Source)
@@ -555,20 +800,21 @@ void solver::copyU0_Uspts(void)
 
 void solver::extrapolateU(void)
 {
-  int m = nFpts;
   int n = nEles * nFields;
-  int k = nSpts;
 
-  auto &A = opers[order].opp_spts_to_fpts(0,0);
   auto &B = U_spts(0,0,0);
   auto &C = U_fpts(0,0,0);
-#ifdef _OMP
-  omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-                    1.0, &A, k, &B, n, 0.0, &C, n);
-#else
-  cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-              1.0, &A, k, &B, n, 0.0, &C, n);
-#endif
+  kern_spts_to_fpts.apply(n, &B, &C, 0.0);
+}
+
+void solver::extrapolateU(uint eStart, uint eEnd)
+{
+  int n = (eEnd - eStart) * nFields;
+  int ld = nEles * nFields;
+
+  auto &B = U_spts(0,eStart,0);
+  auto &C = U_fpts(0,eStart,0);
+  kern_spts_to_fpts.applyCols(n, ld, &B, &C, 0.0);
 }
 
 void solver::calcAvgSolution()
@@ -610,28 +856,17 @@ void solver::checkEntropyPlot()
 
 void solver::extrapolateUMpts(void)
 {
-  int m = nMpts;
   int n = nEles * nFields;
-  int k = nSpts;
 
-  auto &A = opers[order].opp_spts_to_mpts(0,0);
   auto &B = U_spts(0,0,0);
   auto &C = U_mpts(0,0,0);
-#ifdef _OMP
-  omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-              1.0, &A, k, &B, n, 0.0, &C, n);
-#else
-  cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-              1.0, &A, k, &B, n, 0.0, &C, n);
-#endif
+  kern_spts_to_mpts.apply(n, &B, &C, 0.0);
 }
 
 
 void solver::extrapolateUPpts(void)
 {
-  int m = nPpts;
   int n = nEles * nFields;
-  int k = nSpts;
 
 #pragma omp parallel for collapse(2)
   for (int spt = 0; spt < nSpts; spt++) {
@@ -658,16 +893,9 @@ void solver::extrapolateUPpts(void)
     }
   }
 
-  auto &A = opers[order].opp_spts_to_ppts(0,0);
   auto &B = V_spts(0,0,0);
   auto &C = V_ppts(0,0,0);
-#ifdef _OMP
-  omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-              1.0, &A, k, &B, n, 0.0, &C, n);
-#else
-  cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-              1.0, &A, k, &B, n, 0.0, &C, n);
-#endif
+  kern_spts_to_ppts.apply(n, &B, &C, 0.0);
 }
 
 void solver::extrapolateGridVelPpts(void)
@@ -680,7 +908,7 @@ void solver::extrapolateGridVelPpts(void)
   auto &B = gridV_mpts(0,0,0);
   auto &C = gridV_ppts(0,0,0);
 #ifdef _OMP
-  omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+  omp_blocked_gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
               1.0, &A, k, &B, n, 0.0, &C, n);
 #else
   cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
@@ -705,11 +933,16 @@ void solver::extrapolateSFpts(void)
 }
 
 void solver::calcInviscidFlux_spts(void)
+{
+  calcInviscidFlux_spts(0, nEles);
+}
+
+void solver::calcInviscidFlux_spts(uint eStart, uint eEnd)
 {
   double tempF[3][5];
-#pragma omp parallel for collapse(2) private(tempF)
+#pragma omp parallel for collapse(2) private(tempF) if(!omp_in_parallel())
   for (uint spt = 0; spt < nSpts; spt++) {
-    for (uint e = 0; e < nEles; e++) {
+    for (uint e = eStart; e < eEnd; e++) {
       inviscidFlux(&U_spts(spt,e,0), tempF, params);
 
       if (params->motion || params->viscous)
@@ -757,6 +990,13 @@ void solver::calcInviscidFlux_faces()
   }
 }
 
+void solver::calcInviscidFlux_faces(uint fStart, uint fEnd)
+{
+  for (uint i=fStart; i<fEnd; i++) {
+    faces[i]->calcInviscidFlux();
+  }
+}
+
 void solver::calcInviscidFlux_mpi()
 {
   for (uint i=0; i<mpiFaces.size(); i++) {
@@ -768,6 +1008,10 @@ void solver::calcInviscidFlux_overset()
 {
   if (params->oversetMethod == 2) return;
 
+#ifndef _NO_MPI
+  OComm->recvOversetData();
+#endif
+
 #pragma omp parallel for
   for (uint i=0; i<overFaces.size(); i++) {
     overFaces[i]->calcInviscidFlux();
@@ -775,19 +1019,25 @@ void solver::calcInviscidFlux_overset()
 }
 
 void solver::calcViscousFlux_spts(void)
+{
+  calcViscousFlux_spts(0, nEles);
+}
+
+void solver::calcViscousFlux_spts(uint eStart, uint eEnd)
 {
   double tempF[3][5];
-#pragma omp parallel for collapse(2)
+  matrix<double> dU(nDims,nFields);
+#pragma omp parallel for collapse(2) private(tempF) firstprivate(dU) if(!omp_in_parallel())
   for (uint spt = 0; spt < nSpts; spt++) {
-    for (uint e = 0; e < nEles; e++) {
+    for (uint e = eStart; e < eEnd; e++) {
       for (uint dim = 0; dim < nDims; dim++)
         for (uint k = 0; k < nFields; k++)
-          tempDU(dim,k) = dU_spts(dim,spt,e,k);
+          dU(dim,k) = dU_spts(dim,spt,e,k);
 
       if (params->equation == NAVIER_STOKES)
-        viscousFlux(&U_spts(spt,e,0), tempDU, tempF, params);
+        viscousFlux(&U_spts(spt,e,0), dU, tempF, params);
       else
-        viscousFluxAD(tempDU, tempF, params);
+        viscousFluxAD(dU, tempF, params);
 
       /* Add physical inviscid flux at spts */
       for (uint dim = 0; dim < nDims; dim++)
@@ -818,6 +1068,13 @@ void solver::calcViscousFlux_faces()
   }
 }
 
+void solver::calcViscousFlux_faces(uint fStart, uint fEnd)
+{
+  for (uint i=fStart; i<fEnd; i++) {
+    faces[i]->calcViscousFlux();
+  }
+}
+
 void solver::calcViscousFlux_mpi()
 {
   for (uint i=0; i<mpiFaces.size(); i++) {
@@ -829,6 +1086,10 @@ void solver::calcViscousFlux_overset()
 {
   if (params->oversetMethod == 2) return;
 
+#ifndef _NO_MPI
+  OComm->recvOversetGradient();
+#endif
+
 #pragma omp parallel for
   for (uint i=0; i<overFaces.size(); i++) {
     overFaces[i]->calcViscousFlux();
@@ -837,22 +1098,13 @@ void solver::calcViscousFlux_overset()
 
 void solver::calcGradF_spts(void)
 {
-  int m = nSpts;
   int n = nEles * nFields;
-  int k = nSpts;
 
   for (uint dim1=0; dim1<nDims; dim1++) {
     for (uint dim2=0; dim2<nDims; dim2++) {
-      auto &A = opers[order].opp_grad_spts[dim2](0,0);
       auto &B = F_spts(dim1,0,0,0);
       auto &C = dF_spts(dim2,dim1)(0,0,0);
-#ifdef _OMP
-      omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-                  1.0, &A, k, &B, n, 0.0, &C, n);
-#else
-      cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-                  1.0, &A, k, &B, n, 0.0, &C, n);
-#endif
+      kern_grad_spts[dim2].apply(n, &B, &C, 0.0);
     }
   }
 }
@@ -924,32 +1176,32 @@ void solver::calcFluxDivergence(int step)
 
 void solver::calcDivF_spts(int step)
 {
-  int m = nSpts;
   int n = nEles * nFields;
-  int k = nSpts;
 
   auto &C = divF_spts[step](0,0,0);
 
-  auto &A0 = opers[order].opp_grad_spts[0](0,0);
   auto &B0 = F_spts(0,0,0,0);
-#ifdef _OMP
-  omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-              1.0, &A0, k, &B0, n, 0.0, &C, n);
-#else
-  cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-              1.0, &A0, k, &B0, n, 0.0, &C, n);
-#endif
+  kern_grad_spts[0].apply(n, &B0, &C, 0.0);
 
   for (uint dim = 1; dim < nDims; dim++) {
-    auto &A = opers[order].opp_grad_spts[dim](0,0);
     auto &B = F_spts(dim,0,0,0);
-#ifdef _OMP
-    omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-                1.0, &A, k, &B, n, 1.0, &C, n);
-#else
-    cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-                1.0, &A, k, &B, n, 1.0, &C, n);
-#endif
+    kern_grad_spts[dim].apply(n, &B, &C, 1.0);
+  }
+}
+
+void solver::calcDivF_spts(int step, uint eStart, uint eEnd)
+{
+  int n = (eEnd - eStart) * nFields;
+  int ld = nEles * nFields;
+
+  auto &C = divF_spts[step](0,eStart,0);
+
+  auto &B0 = F_spts(0,0,eStart,0);
+  kern_grad_spts[0].applyCols(n, ld, &B0, &C, 0.0);
+
+  for (uint dim = 1; dim < nDims; dim++) {
+    auto &B = F_spts(dim,0,eStart,0);
+    kern_grad_spts[dim].applyCols(n, ld, &B, &C, 1.0);
   }
 }
 
@@ -959,21 +1211,11 @@ void solver::extrapolateNormalFlux(void)
   {
     /* Extrapolate physical normal flux */
 
-    int m = nFpts;
     int n = nEles * nFields;
-    int k = nSpts;
-
-    auto &A = opers[order].opp_spts_to_fpts(0,0);
 
     auto &B = F_spts(0, 0, 0, 0);
     auto &C = disFn_fpts(0, 0, 0);
-#ifdef _OMP
-    omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-                1.0, &A, k, &B, n, 0.0, &C, n);
-#else
-    cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-                1.0, &A, k, &B, n, 0.0, &C, n);
-#endif
+    kern_spts_to_fpts.apply(n, &B, &C, 0.0);
 
 #pragma omp parallel for collapse(3)
     for (uint fpt = 0; fpt < nFpts; fpt++)
@@ -984,13 +1226,7 @@ void solver::extrapolateNormalFlux(void)
     for (uint dim = 1; dim < nDims; dim++) {
       auto &B = F_spts(dim, 0, 0, 0);
       auto &C = tempVars_fpts(0, 0, 0);
-#ifdef _OMP
-      omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-                  1.0, &A, k, &B, n, 0.0, &C, n);
-#else
-      cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-                  1.0, &A, k, &B, n, 0.0, &C, n);
-#endif
+      kern_spts_to_fpts.apply(n, &B, &C, 0.0);
 
 #pragma omp parallel for collapse(3)
       for (uint fpt = 0; fpt < nFpts; fpt++)
@@ -1003,36 +1239,38 @@ void solver::extrapolateNormalFlux(void)
   {
     /* Extrapolate transformed normal flux */
 
-    int m = nFpts;
     int n = nEles * nFields;
-    int k = nSpts;
 
     auto &C = disFn_fpts(0, 0, 0);
 
-    auto &A = opers[order].opp_extrapolateFn[0](0,0);
     auto &B = F_spts(0, 0, 0, 0);
-#ifdef _OMP
-    omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-                1.0, &A, k, &B, n, 0.0, &C, n);
-#else
-    cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-                1.0, &A, k, &B, n, 0.0, &C, n);
-#endif
+    kern_extrapolateFn[0].apply(n, &B, &C, 0.0);
 
     for (uint dim = 1; dim < nDims; dim++) {
-      auto &A = opers[order].opp_extrapolateFn[dim](0,0);
       auto &B = F_spts(dim, 0, 0, 0);
-#ifdef _OMP
-      omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-                  1.0, &A, k, &B, n, 1.0, &C, n);
-#else
-      cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-                  1.0, &A, k, &B, n, 1.0, &C, n);
-#endif
+      kern_extrapolateFn[dim].apply(n, &B, &C, 1.0);
     }
   }
 }
 
+void solver::extrapolateNormalFlux(uint eStart, uint eEnd)
+{
+  /* Extrapolate transformed normal flux [static grids only] */
+
+  int n = (eEnd - eStart) * nFields;
+  int ld = nEles * nFields;
+
+  auto &C = disFn_fpts(0, eStart, 0);
+
+  auto &B = F_spts(0, 0, eStart, 0);
+  kern_extrapolateFn[0].applyCols(n, ld, &B, &C, 0.0);
+
+  for (uint dim = 1; dim < nDims; dim++) {
+    auto &B = F_spts(dim, 0, eStart, 0);
+    kern_extrapolateFn[dim].applyCols(n, ld, &B, &C, 1.0);
+  }
+}
+
 void solver::correctDivFlux(int step)
 {
 #pragma omp parallel for collapse(3)
@@ -1041,39 +1279,48 @@ void solver::correctDivFlux(int step)
       for (uint k = 0; k < nFields; k++)
         disFn_fpts(fpt, e, k) = Fn_fpts(fpt, e, k) - disFn_fpts(fpt, e, k);
 
-  int m = nSpts;
   int n = nEles * nFields;
-  int k = nFpts;
 
-  auto &A = opers[order].opp_correction(0,0);
   auto &B = disFn_fpts(0,0,0);
   auto &C = divF_spts[step](0,0,0);
-#ifdef _OMP
-  omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-              1.0, &A, k, &B, n, 1.0, &C, n);
-#else
-  cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-              1.0, &A, k, &B, n, 1.0, &C, n);
-#endif
+  kern_correction.apply(n, &B, &C, 1.0);
+}
+
+void solver::correctDivFlux(int step, uint eStart, uint eEnd)
+{
+  for (uint fpt = 0; fpt < nFpts; fpt++)
+    for (uint e = eStart; e < eEnd; e++)
+      for (uint k = 0; k < nFields; k++)
+        disFn_fpts(fpt, e, k) = Fn_fpts(fpt, e, k) - disFn_fpts(fpt, e, k);
+
+  int n = (eEnd - eStart) * nFields;
+  int ld = nEles * nFields;
+
+  auto &B = disFn_fpts(0,eStart,0);
+  auto &C = divF_spts[step](0,eStart,0);
+  kern_correction.applyCols(n, ld, &B, &C, 1.0);
 }
 
 void solver::calcGradU_spts(void)
 {
-  int m = nSpts;
   int n = nEles * nFields;
-  int k = nSpts;
 
   for (uint dim1=0; dim1<nDims; dim1++) {
-    auto &A = opers[order].opp_grad_spts[dim1](0,0);
     auto &B = U_spts(0,0,0);
     auto &C = dU_spts(dim1,0,0,0);
-#ifdef _OMP
-    omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-                1.0, &A, k, &B, n, 0.0, &C, n);
-#else
-    cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-                1.0, &A, k, &B, n, 0.0, &C, n);
-#endif
+    kern_grad_spts[dim1].apply(n, &B, &C, 0.0);
+  }
+}
+
+void solver::calcGradU_spts(uint eStart, uint eEnd)
+{
+  int n = (eEnd - eStart) * nFields;
+  int ld = nEles * nFields;
+
+  for (uint dim1=0; dim1<nDims; dim1++) {
+    auto &B = U_spts(0,eStart,0);
+    auto &C = dU_spts(dim1,0,eStart,0);
+    kern_grad_spts[dim1].applyCols(n, ld, &B, &C, 0.0);
   }
 }
 
@@ -1081,31 +1328,42 @@ void solver::correctGradU(void)
 {
   /* Apply correction to solution gradient in reference space */
 
-  int m = nSpts;
   int n = nEles * nFields;
-  int k = nFpts;
 
   auto &B = dUc_fpts(0,0,0);
 
   for (uint dim = 0; dim < nDims; dim++) {
-    auto &A = opers[order].opp_correctU[dim](0,0);
     auto &C = dU_spts(dim, 0, 0, 0);
-#ifdef _OMP
-    omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-                1.0, &A, k, &B, n, 1.0, &C, n);
-#else
-    cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-                1.0, &A, k, &B, n, 1.0, &C, n);
-#endif
+    kern_correctU[dim].apply(n, &B, &C, 1.0);
   }
 
   /* Transform back to physical space */
 
+  transformGradU_spts(0, nEles);
+}
+
+void solver::correctGradU(uint eStart, uint eEnd)
+{
+  int n = (eEnd - eStart) * nFields;
+  int ld = nEles * nFields;
+
+  auto &B = dUc_fpts(0,eStart,0);
+
+  for (uint dim = 0; dim < nDims; dim++) {
+    auto &C = dU_spts(dim, 0, eStart, 0);
+    kern_correctU[dim].applyCols(n, ld, &B, &C, 1.0);
+  }
+
+  transformGradU_spts(eStart, eEnd);
+}
+
+void solver::transformGradU_spts(uint eStart, uint eEnd)
+{
   if (nDims == 2)
   {
-#pragma omp parallel for collapse(2)
+#pragma omp parallel for collapse(2) if(!omp_in_parallel())
     for (uint spt = 0; spt < nSpts; spt++) {
-      for (uint e = 0; e < nEles; e++) {
+      for (uint e = eStart; e < eEnd; e++) {
         double invDet = 1./detJac_spts(spt,e);
         for (uint k = 0; k < nFields; k++) {
           double ur = dU_spts(0,spt,e,k);
@@ -1118,9 +1376,9 @@ void solver::correctGradU(void)
   }
   else
   {
-#pragma omp parallel for collapse(2)
+#pragma omp parallel for collapse(2) if(!omp_in_parallel())
     for (uint spt = 0; spt < nSpts; spt++) {
-      for (uint e = 0; e < nEles; e++) {
+      for (uint e = eStart; e < eEnd; e++) {
         double invDet = 1./detJac_spts(spt,e);
         for (uint k = 0; k < nFields; k++) {
           double ur = dU_spts(0,spt,e,k);
@@ -1138,22 +1396,24 @@ void solver::correctGradU(void)
 
 void solver::extrapolateGradU()
 {
-  int m = nFpts;
   int n = nEles * nFields;
-  int k = nSpts;
-
-  auto &A = opers[order].opp_spts_to_fpts(0,0);
 
   for (uint dim=0; dim<nDims; dim++) {
     auto &B = dU_spts(dim,0,0,0);
     auto &C = dU_fpts(dim,0,0,0);
-#ifdef _OMP
-    omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-                1.0, &A, k, &B, n, 0.0, &C, n);
-#else
-    cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
-                1.0, &A, k, &B, n, 0.0, &C, n);
-#endif
+    kern_spts_to_fpts.apply(n, &B, &C, 0.0);
+  }
+}
+
+void solver::extrapolateGradU(uint eStart, uint eEnd)
+{
+  int n = (eEnd - eStart) * nFields;
+  int ld = nEles * nFields;
+
+  for (uint dim=0; dim<nDims; dim++) {
+    auto &B = dU_spts(dim,0,eStart,0);
+    auto &C = dU_fpts(dim,0,eStart,0);
+    kern_spts_to_fpts.applyCols(n, ld, &B, &C, 0.0);
   }
 }
 
@@ -1176,20 +1436,7 @@ void solver::moveMesh(int step)
         Geo->updateADT();
       Geo->processBlanks(eles,faces,mpiFaces,overFaces,this);
       Geo->processUnblanks(eles,faces,mpiFaces,overFaces,this);
-      if (params->projection)
-      {
-        /* --- Use LGP with supermeshing; NOTE: For linear shape funcs only --- */
-        OComm->matchUnblankCells(eles,Geo->unblankCells,Geo->eleMap,params->quadOrder);
-        OComm->performGalerkinProjection(eles,opers,Geo->eleMap,order);
-      }
-      else
-      {
-        /* --- Use collocation projection; Use for nonlinear shape funcs --- */
-        OComm->setupFringeCellPoints(eles,Geo->unblankCells,Geo->eleMap);
-        OComm->matchOversetPoints(eles,Geo->eleMap,Geo->minPt,Geo->maxPt);
-        OComm->exchangeOversetData(eles,opers,Geo->eleMap);
-        OComm->transferEleData(eles,Geo->unblankCells,Geo->eleMap);
-      }
+      projectUnblankCells();
     }
 
     if (params->oversetMethod == 2) {
@@ -1197,8 +1444,7 @@ void solver::moveMesh(int step)
         OComm->matchUnblankCells(eles,Geo->fringeCells,Geo->eleMap,params->quadOrder);
         OComm->performGalerkinProjection(eles,opers,Geo->eleMap,order);
       } else {
-        if (params->nDims==2)
-          getBoundingBox(Geo->xv,Geo->minPt,Geo->maxPt);
+        getBoundingBox(Geo->xv,Geo->minPt,Geo->maxPt);
         OComm->setupFringeCellPoints(eles,Geo->fringeCells,Geo->eleMap);
         OComm->matchOversetPoints(eles,Geo->eleMap,Geo->minPt,Geo->maxPt);
         OComm->exchangeOversetData(eles,opers,Geo->eleMap);
@@ -1220,8 +1466,7 @@ void solver::moveMesh(int step)
     Geo->updateADT();
 
     if (params->oversetMethod != 2) {
-      if (params->nDims==2)
-        getBoundingBox(Geo->xv,Geo->minPt,Geo->maxPt);
+      getBoundingBox(Geo->xv,Geo->minPt,Geo->maxPt);
       int nPtsFace = order+1;
       if (nDims == 3) nPtsFace *= order+1;
       OComm->setupOverFacePoints(overFaces,nPtsFace);
@@ -1268,7 +1513,7 @@ void solver::setPosSptsFpts(void)
   auto &As = shape_spts(0,0);
   auto &Cs = pos_spts(0,0,0);
 #ifdef _OMP
-  omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, ms, n, k,
+  omp_blocked_gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, ms, n, k,
               1.0, &As, k, &B, n, 0.0, &Cs, n);
 #else
   cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, ms, n, k,
@@ -1278,7 +1523,7 @@ void solver::setPosSptsFpts(void)
   auto &Af = shape_fpts(0,0);
   auto &Cf = pos_fpts(0,0,0);
 #ifdef _OMP
-  omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, mf, n, k,
+  omp_blocked_gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, mf, n, k,
               1.0, &Af, k, &B, n, 0.0, &Cf, n);
 #else
   cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, mf, n, k,
@@ -1288,7 +1533,7 @@ void solver::setPosSptsFpts(void)
   auto &Ap = shape_ppts(0,0);
   auto &Cp = pos_ppts(0,0,0);
 #ifdef _OMP
-  omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, mp, n, k,
+  omp_blocked_gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, mp, n, k,
               1.0, &Ap, k, &B, n, 0.0, &Cp, n);
 #else
   cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, mp, n, k,
@@ -1298,7 +1543,7 @@ void solver::setPosSptsFpts(void)
   auto &Ac = shape_cpts(0,0);
   auto &Cc = pos_cpts(0,0,0);
 #ifdef _OMP
-  omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, mp, n, k,
+  omp_blocked_gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, mp, n, k,
               1.0, &Ap, k, &B, n, 0.0, &Cp, n);
 #else
   cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, mc, n, k,
@@ -1334,7 +1579,7 @@ void solver::updatePosSptsFpts(void)
   auto &As = shape_spts(0,0);
   auto &Cs = pos_spts(0,0,0);
 #ifdef _OMP
-  omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, ms, n, k,
+  omp_blocked_gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, ms, n, k,
               1.0, &As, k, &B, n, 0.0, &Cs, n);
 #else
   cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, ms, n, k,
@@ -1344,7 +1589,7 @@ void solver::updatePosSptsFpts(void)
   auto &Af = shape_fpts(0,0);
   auto &Cf = pos_fpts(0,0,0);
 #ifdef _OMP
-  omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, mf, n, k,
+  omp_blocked_gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, mf, n, k,
               1.0, &Af, k, &B, n, 0.0, &Cf, n);
 #else
   cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, mf, n, k,
@@ -1354,7 +1599,7 @@ void solver::updatePosSptsFpts(void)
   auto &Ap = shape_ppts(0,0);
   auto &Cp = pos_ppts(0,0,0);
 #ifdef _OMP
-  omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, mp, n, k,
+  omp_blocked_gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, mp, n, k,
               1.0, &Ap, k, &B, n, 0.0, &Cp, n);
 #else
   cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, mp, n, k,
@@ -1383,7 +1628,7 @@ void solver::updateGridVSptsFpts(void)
   auto &As = shape_spts(0,0);
   auto &Cs = gridV_spts(0,0,0);
 #ifdef _OMP
-  omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, ms, n, k,
+  omp_blocked_gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, ms, n, k,
               1.0, &As, k, &B, n, 0.0, &Cs, n);
 #else
   cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, ms, n, k,
@@ -1393,7 +1638,7 @@ void solver::updateGridVSptsFpts(void)
   auto &Af = shape_fpts(0,0);
   auto &Cf = gridV_fpts(0,0,0);
 #ifdef _OMP
-  omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, mf, n, k,
+  omp_blocked_gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, mf, n, k,
               1.0, &Af, k, &B, n, 0.0, &Cf, n);
 #else
   cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, mf, n, k,
@@ -1601,9 +1846,9 @@ void solver::calcTransforms(void)
     auto &Cf = Jac_fpts(dim, 0, 0, 0);
 
 #ifdef _OMP
-  omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, ms, n, k,
+  omp_blocked_gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, ms, n, k,
               1.0, &As, k, &B, n, 0.0, &Cs, n);
-  omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, mf, n, k,
+  omp_blocked_gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, mf, n, k,
               1.0, &Af, k, &B, n, 0.0, &Cf, n);
 #else
   cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, ms, n, k,
@@ -1691,6 +1936,17 @@ void solver::calcTransforms(void)
       }
     }
   }
+
+  /* --- Element volumes for CFL-based time step --- */
+  if (params->dtType != 0) {
+    auto wts = getQptWeights(order, nDims);
+    vol_eles.assign(nEles, 0.);
+
+#pragma omp parallel for
+    for (uint e = 0; e < nEles; e++)
+      for (uint spt = 0; spt < nSpts; spt++)
+        vol_eles[e] += detJac_spts(spt,e) * wts[spt];
+  }
 }
 
 void solver::updateTransforms(void)
@@ -1703,6 +1959,17 @@ void solver::updateTransforms(void)
   {
     for (auto &ic:Geo->unblankCells)
       eles[Geo->eleMap[ic]]->calcTransforms(true);
+
+    /* --- Volumes of the newly-unblanked elements for CFL-based time step --- */
+    if (params->dtType != 0) {
+      auto wts = getQptWeights(order, nDims);
+      for (auto &ic:Geo->unblankCells) {
+        int e = Geo->eleMap[ic];
+        vol_eles[e] = 0.;
+        for (uint spt = 0; spt < nSpts; spt++)
+          vol_eles[e] += detJac_spts(spt,e) * wts[spt];
+      }
+    }
   }
 }
 
@@ -1739,6 +2006,368 @@ vector<double> solver::computeMassFlux(void)
   return flux;
 }
 
+void solver::setupProbes(void)
+{
+  probePts.clear();
+
+  if (params->probeFile.empty()) return;
+
+  if (params->rank==0) cout << "Solver: Setting up point probes" << endl;
+
+  ifstream probeFile(params->probeFile.c_str());
+  if (!probeFile.is_open())
+    FatalError("Unable to open probe file.");
+
+  // One probe per line: x y [z]
+  string str;
+  while (getline(probeFile,str)) {
+    stringstream ss(str);
+    point pt;
+    if (!(ss >> pt.x >> pt.y)) continue;
+    if (nDims == 3 && !(ss >> pt.z)) continue;
+    probePts.push_back(pt);
+  }
+
+  probeFile.close();
+
+  probeIDs.clear();
+  probeEles.clear();
+  probeIDg.clear();
+  probeOwner.clear();
+
+  locateProbes();
+
+  if (params->rank == 0) {
+    int nLost = std::count(probeOwner.begin(), probeOwner.end(), params->nproc);
+    cout << "Solver: " << probePts.size() - nLost << " of " << probePts.size() << " probes located" << endl;
+  }
+}
+
+void solver::locateProbes(void)
+{
+  int nProbes = probePts.size();
+
+  vector<int> donor(nProbes, -1);
+  vector<point> refLoc(nProbes);
+
+  /* --- Warm start: re-check the previous donor of each probe held here
+   *     [moving grids]; donors are cached by global ID, as eles may have
+   *     been re-ordered or blanked since --- */
+
+  vector<int> missed;
+  if (!probeIDs.empty()) {
+    map<int,int> IDg2e;
+    for (uint e = 0; e < eles.size(); e++)
+      IDg2e[eles[e]->IDg] = e;
+
+#pragma omp parallel for
+    for (uint i = 0; i < probeIDs.size(); i++) {
+      int p = probeIDs[i];
+      auto it = IDg2e.find(probeIDg[i]);
+      if (it == IDg2e.end()) continue;
+
+      int e = it->second;
+      if (params->meshType == OVERSET_MESH && Geo->iblankCell[eles[e]->ID] != NORMAL) continue;
+
+      if (eles[e]->getRefLocNewton(probePts[p],refLoc[p]))
+        donor[p] = e;
+    }
+
+    for (auto p : probeIDs)
+      if (donor[p] < 0) missed.push_back(p);
+  }
+
+  /* --- Every rank searches for the probes which were lost or missed --- */
+
+  vector<int> search;
+  if ((int)probeOwner.size() != nProbes) {
+    probeOwner.assign(nProbes, params->nproc);
+    for (int p = 0; p < nProbes; p++)
+      search.push_back(p);
+  }
+  else {
+    for (int p = 0; p < nProbes; p++)
+      if (probeOwner[p] == params->nproc) search.push_back(p);
+
+#ifndef _NO_MPI
+    int nMissed = missed.size();
+    vector<int> nMissed_rank(params->nproc), offset(params->nproc+1, 0);
+    MPI_Allgather(&nMissed, 1, MPI_INT, nMissed_rank.data(), 1, MPI_INT, MPI_COMM_WORLD);
+    for (int p = 0; p < params->nproc; p++)
+      offset[p+1] = offset[p] + nMissed_rank[p];
+
+    vector<int> missed_all(offset[params->nproc]);
+    MPI_Allgatherv(missed.data(), nMissed, MPI_INT, missed_all.data(), nMissed_rank.data(),
+                   offset.data(), MPI_INT, MPI_COMM_WORLD);
+    search.insert(search.end(), missed_all.begin(), missed_all.end());
+#else
+    search.insert(search.end(), missed.begin(), missed.end());
+#endif
+  }
+
+  int nSearch = search.size();
+  if (nSearch > 0) {
+    vector<double> bbox(6*eles.size());
+    for (uint e = 0; e < eles.size(); e++) {
+      auto box = eles[e]->getBoundingBox();
+      for (int i = 0; i < 6; i++)
+        bbox[6*e+i] = box[i];
+    }
+
+#pragma omp parallel for schedule(dynamic)
+    for (int i = 0; i < nSearch; i++) {
+      int p = search[i];
+      point pt = probePts[p];
+
+      donor[p] = -1;
+      for (uint e = 0; e < eles.size(); e++) {
+        if (params->meshType == OVERSET_MESH && Geo->iblankCell[eles[e]->ID] != NORMAL) continue;
+
+        double *box = &bbox[6*e];
+        if (pt.x < box[0] || pt.y < box[1] || pt.x > box[3] || pt.y > box[4]) continue;
+        if (nDims == 3 && (pt.z < box[2] || pt.z > box[5])) continue;
+
+        if (eles[e]->getRefLocNewton(pt,refLoc[p])) {
+          donor[p] = e;
+          break;
+        }
+      }
+    }
+
+    /* --- Probes on partition boundaries go to the lowest rank which found them --- */
+
+    vector<int> owner(nSearch);
+    for (int i = 0; i < nSearch; i++)
+      owner[i] = (donor[search[i]] >= 0) ? params->rank : params->nproc;
+
+#ifndef _NO_MPI
+    MPI_Allreduce(MPI_IN_PLACE, owner.data(), nSearch, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+#endif
+
+    for (int i = 0; i < nSearch; i++)
+      probeOwner[search[i]] = owner[i];
+  }
+
+  probeIDs.clear();
+  probeEles.clear();
+  probeIDg.clear();
+  for (int p = 0; p < nProbes; p++) {
+    if (probeOwner[p] == params->rank) {
+      probeIDs.push_back(p);
+      probeEles.push_back(donor[p]);
+      probeIDg.push_back(eles[donor[p]]->IDg);
+    }
+  }
+
+  /* --- Interpolation weights from the donor's solution points --- */
+
+  probeWts.setup(probeIDs.size(), nSpts);
+  probeV.setup(probeIDs.size(), nFields);
+
+  vector<double> weights;
+  for (uint i = 0; i < probeIDs.size(); i++) {
+    opers[order].getBasisValues(refLoc[probeIDs[i]], weights);
+    for (uint spt = 0; spt < nSpts; spt++)
+      probeWts(i,spt) = weights[spt];
+  }
+}
+
+void solver::calcProbeData(void)
+{
+  if (params->motion)
+    locateProbes();
+
+#pragma omp parallel for
+  for (uint i = 0; i < probeIDs.size(); i++) {
+    int ele = eles[probeEles[i]]->sID;
+
+    double U[5] = {0};
+    for (uint spt = 0; spt < nSpts; spt++) {
+      double wt = probeWts(i,spt);
+      for (uint k = 0; k < nFields; k++)
+        U[k] += wt * U_spts(spt,ele,k);
+    }
+
+    if (params->equation == ADVECTION_DIFFUSION) {
+      probeV(i,0) = U[0];
+    }
+    else if (params->equation == NAVIER_STOKES) {
+      double rho = U[0];
+      double vMagSq = 0;
+      probeV(i,0) = rho;
+      for (uint dim = 0; dim < nDims; dim++) {
+        probeV(i,dim+1) = U[dim+1] / rho;
+        vMagSq += probeV(i,dim+1) * probeV(i,dim+1);
+      }
+      probeV(i,nDims+1) = (params->gamma-1)*(U[nDims+1] - 0.5*rho*vMagSq);
+    }
+  }
+}
+
+void solver::calcModes(void)
+{
+  U_modes.setup(nSpts, nEles, nFields);
+  pos_modes.setup(nSpts, nEles, nDims);
+
+  kern_spts_to_modes.apply(nEles*nFields, &U_spts(0,0,0), &U_modes(0,0,0), 0.0);
+  kern_spts_to_modes.apply(nEles*nDims, &pos_spts(0,0,0), &pos_modes(0,0,0), 0.0);
+}
+
+void solver::calcWallDistance(void)
+{
+  double maxDist = -1;
+  for (auto &R:params->plotRegions)
+    maxDist = std::max(maxDist, R.wallDist);
+
+  bool first = eleWallDist.empty();
+  eleWallDist.assign(nEles, INFINITY);
+
+  if (maxDist <= 0) return;
+
+  if (params->rank==0 && first) cout << "Solver: Computing wall distance for plot regions" << endl;
+
+  /* --- Sample the wall boundaries at their face vertices & centroids --- */
+
+  vector<double> wallPts;
+  for (int i = 0; i < Geo->nBndFaces; i++) {
+    int bc = Geo->bcType[i];
+    if (bc != SLIP_WALL && bc != ISOTHERMAL_NOSLIP && bc != ADIABATIC_NOSLIP && bc != ISOTHERMAL_NOSLIP_MOVING)
+      continue;
+
+    int ff = Geo->bndFaces[i];
+    int nv = Geo->f2nv[ff];
+    point centroid;
+    for (int j = 0; j < nv; j++) {
+      point pt = point(Geo->xv[Geo->f2v(ff,j)], nDims);
+      centroid += pt;
+      wallPts.push_back(pt.x);
+      wallPts.push_back(pt.y);
+      wallPts.push_back(pt.z);
+    }
+    centroid /= nv;
+    wallPts.push_back(centroid.x);
+    wallPts.push_back(centroid.y);
+    wallPts.push_back(centroid.z);
+  }
+
+#ifndef _NO_MPI
+  // Walls on any rank [or grid] may be close to this rank's elements
+  int nLocal = wallPts.size();
+  vector<int> nPts_rank(params->nproc), disp(params->nproc);
+  MPI_Allgather(&nLocal, 1, MPI_INT, nPts_rank.data(), 1, MPI_INT, MPI_COMM_WORLD);
+
+  int nTot = 0;
+  for (int p = 0; p < params->nproc; p++) {
+    disp[p] = nTot;
+    nTot += nPts_rank[p];
+  }
+
+  vector<double> localPts = wallPts;
+  wallPts.resize(nTot);
+  MPI_Allgatherv(localPts.data(), nLocal, MPI_DOUBLE, wallPts.data(), nPts_rank.data(),
+                 disp.data(), MPI_DOUBLE, MPI_COMM_WORLD);
+#endif
+
+  int nWallPts = wallPts.size() / 3;
+  vector<point> walls(nWallPts);
+  for (int i = 0; i < nWallPts; i++)
+    walls[i] = point(&wallPts[3*i]);
+
+  // Sort by x so each spt only checks the wall points within maxDist in x
+  std::sort(walls.begin(), walls.end(), [](const point &a, const point &b) { return a.x < b.x; });
+
+  /* --- Min. distance over each element's spts, out to maxDist --- */
+
+#pragma omp parallel for
+  for (uint ele = 0; ele < nEles; ele++) {
+    double minDist = INFINITY;
+    for (uint spt = 0; spt < nSpts; spt++) {
+      point pt = point(&pos_spts(spt,ele,0), nDims);
+      auto it = std::lower_bound(walls.begin(), walls.end(), pt.x - maxDist,
+                                 [](const point &a, double x) { return a.x < x; });
+      for (; it != walls.end() && it->x <= pt.x + maxDist; it++)
+        minDist = std::min(minDist, getDist(*it, pt));
+    }
+
+    if (minDist <= maxDist)
+      eleWallDist[ele] = minDist;
+  }
+}
+
+void solver::accumulateStats(void)
+{
+  /* --- Weighted (Welford) update of the means & co-moment sums:
+   *     mean += w/W * (V - mean_old);  C_ij += w * (V_i - mean_old_i) * (V_j - mean_j) --- */
+
+  double w = (statsTime > 0) ? params->time - statsLastTime : params->dt;
+  statsLastTime = params->time;
+  if (w <= 0) return;
+
+  statsTime += w;
+  double a = w / statsTime;
+
+#pragma omp parallel for collapse(2)
+  for (uint spt = 0; spt < nSpts; spt++) {
+    for (uint e = 0; e < nEles; e++) {
+      double V[5], dV[5];
+      if (params->equation == ADVECTION_DIFFUSION) {
+        V[0] = U_spts(spt,e,0);
+      }
+      else {
+        double rho = U_spts(spt,e,0);
+        double vMagSq = 0;
+        V[0] = rho;
+        for (uint dim = 0; dim < nDims; dim++) {
+          V[dim+1] = U_spts(spt,e,dim+1) / rho;
+          vMagSq += V[dim+1]*V[dim+1];
+        }
+        V[nDims+1] = (params->gamma-1)*(U_spts(spt,e,nDims+1) - 0.5*rho*vMagSq);
+      }
+
+      double *S = &stats_spts(spt,e,0);
+
+      for (uint k = 0; k < nFields; k++) {
+        dV[k] = V[k] - S[k];
+        S[k] += a*dV[k];
+      }
+
+      for (uint k = 0; k < nFields; k++)
+        S[nFields+k] += w*dV[k]*(V[k] - S[k]);
+
+      // Velocity cross-covariances [uv, uw, vw]
+      if (params->equation == NAVIER_STOKES) {
+        uint ind = 2*nFields;
+        for (uint i = 1; i <= nDims; i++)
+          for (uint j = i+1; j <= nDims; j++)
+            S[ind++] += w*dV[i]*(V[j] - S[j]);
+      }
+    }
+  }
+}
+
+void solver::extrapolateStatsPpts(void)
+{
+  Array<double,3> stats(nSpts, nEles, nStats);
+
+  double invTime = (statsTime > 0) ? 1./statsTime : 0.;
+
+#pragma omp parallel for collapse(2)
+  for (uint spt = 0; spt < nSpts; spt++) {
+    for (uint e = 0; e < nEles; e++) {
+      for (uint k = 0; k < nFields; k++)
+        stats(spt,e,k) = stats_spts(spt,e,k);
+      for (uint k = nFields; k < nStats; k++)
+        stats(spt,e,k) = stats_spts(spt,e,k) * invTime;
+    }
+  }
+
+  int n = nEles * nStats;
+
+  auto &B = stats(0,0,0);
+  auto &C = stats_ppts(0,0,0);
+  kern_spts_to_ppts.apply(n, &B, &C, 0.0);
+}
+
 void solver::setupOperators()
 {
   if (params->rank==0) cout << "Solver: Setting up FR operators" << endl;
@@ -1749,6 +2378,123 @@ void solver::setupOperators()
     opers[order].setupOperators(HEX,order,Geo,params);
 }
 
+void solver::setupKernels(void)
+{
+  auto &opp = opers[order];
+
+  kern_spts_to_fpts.setup(opp.opp_spts_to_fpts, "spts_to_fpts");
+  kern_spts_to_mpts.setup(opp.opp_spts_to_mpts, "spts_to_mpts");
+  kern_spts_to_ppts.setup(opp.opp_spts_to_ppts, "spts_to_ppts");
+  kern_correction.setup(opp.opp_correction, "correction");
+
+  if (params->plotType == 2)
+    kern_spts_to_modes.setup(opp.opp_spts_to_modes, "spts_to_modes");
+
+  kern_grad_spts.resize(nDims);
+  kern_extrapolateFn.resize(nDims);
+  for (uint dim = 0; dim < nDims; dim++) {
+    kern_grad_spts[dim].setup(opp.opp_grad_spts[dim], "grad_spts_"+to_string(dim));
+    kern_extrapolateFn[dim].setup(opp.opp_extrapolateFn[dim], "extrapolateFn_"+to_string(dim));
+  }
+
+  if (params->viscous) {
+    kern_correctU.resize(nDims);
+    for (uint dim = 0; dim < nDims; dim++)
+      kern_correctU[dim].setup(opp.opp_correctU[dim], "correctU_"+to_string(dim));
+  }
+
+  if (!params->autotune) return;
+
+  if (params->rank==0) cout << "Solver: Autotuning operator backends" << endl;
+
+  oppTuner tuner;
+  tuner.setup(params);
+
+  int n = nEles * nFields;
+
+  tuner.tune<double>(kern_spts_to_fpts, n, 0.0);
+  tuner.tune<double>(kern_spts_to_mpts, n, 0.0);
+  tuner.tune<double>(kern_spts_to_ppts, n, 0.0);
+
+  // The flux operators run on flux_t [float under PRECISION=MIXED]; grad_spts
+  // also gives dU_spts in double, but the flux divergence is its per-stage use
+  tuner.tune<flux_t>(kern_correction, n, 1.0);
+
+  for (uint dim = 0; dim < nDims; dim++) {
+    tuner.tune<flux_t>(kern_grad_spts[dim], n, 1.0);
+    tuner.tune<flux_t>(kern_extrapolateFn[dim], n, 1.0);
+  }
+
+  if (params->viscous) {
+    for (uint dim = 0; dim < nDims; dim++)
+      tuner.tune<double>(kern_correctU[dim], n, 1.0);
+  }
+
+  tuner.writeCache();
+}
+
+void solver::setupTaskGraph(void)
+{
+  useTasks = false;
+
+#ifdef _OMP
+  /* --- Moving & overset grids and the stabilization/shock-capturing
+   * procedures use the staged version of calcResidual --- */
+  if (!params->residualTasks || nEles == 0 || params->motion || params->squeeze ||
+      params->scFlag || params->meshType == OVERSET_MESH)
+    return;
+
+  if (params->nproc > 1 && !params->mpiFunneled) {
+    if (params->rank == 0)
+      cout << "Solver: MPI library lacks MPI_THREAD_FUNNELED support; using the staged residual" << endl;
+    return;
+  }
+
+  useTasks = true;
+
+  /* --- Split the elements & faces into a few blocks per thread --- */
+
+  uint nBlocks = std::min(nEles, (uint)(N_TASKS_PER_THREAD * omp_get_max_threads()));
+  uint nChunks = std::min((uint)faces.size(), nBlocks);
+
+  eleBlocks.resize(nBlocks);
+  for (uint b = 0; b < nBlocks; b++)
+    eleBlocks[b] = {{b * nEles / nBlocks, (b+1) * nEles / nBlocks}};
+
+  faceChunks.resize(nChunks);
+  for (uint c = 0; c < nChunks; c++)
+    faceChunks[c] = {{c * (uint)faces.size() / nChunks, (c+1) * (uint)faces.size() / nChunks}};
+
+  /* --- Find the element blocks touched by each face chunk --- */
+
+  vector<int> eleBlock(nEles);
+  for (uint b = 0; b < nBlocks; b++)
+    for (uint e = eleBlocks[b][0]; e < eleBlocks[b][1]; e++)
+      eleBlock[e] = b;
+
+  chunkBlocks.assign(nChunks, vector<int>());
+  blockChunks.assign(nBlocks, vector<int>());
+  for (uint c = 0; c < nChunks; c++) {
+    set<int> blocks;
+    for (uint i = faceChunks[c][0]; i < faceChunks[c][1]; i++) {
+      blocks.insert(eleBlock[faces[i]->eL->sID]);
+      if (faces[i]->eR)
+        blocks.insert(eleBlock[faces[i]->eR->sID]);
+    }
+
+    for (int b : blocks) {
+      chunkBlocks[c].push_back(b);
+      blockChunks[b].push_back(c);
+    }
+  }
+
+  depU.resize(nBlocks);
+  depDU.resize(nBlocks);
+  depF.resize(nBlocks);
+  depFn.resize(nChunks);
+#endif
+}
+
 void solver::setupElesFaces(void) {
 
   if (params->rank==0) cout << "Solver: Setting up elements & faces" << endl;
@@ -1798,6 +2544,9 @@ void solver::readRestartFile(void) {
   /* --- All processors read their data from their own .vtu file --- */
   if (params->meshType == OVERSET_MESH)
     sprintf(fileNameC,"%s_%.09d/%s%d_%.09d_%d.vtu",&fileName[0],params->restartIter,&fileName[0],gridID,params->restartIter,gridRank);
+  else if (params->nPlotFiles > 0)
+    sprintf(fileNameC,"%s_%.09d/%s_%.09d_%d.vtu",&fileName[0],params->restartIter,&fileName[0],params->restartIter,
+            params->rank * std::min(params->nPlotFiles,params->nproc) / params->nproc);
   else
     sprintf(fileNameC,"%s_%.09d/%s_%.09d_%d.vtu",&fileName[0],params->restartIter,&fileName[0],params->restartIter,params->rank);
 #else
@@ -1817,6 +2566,7 @@ void solver::readRestartFile(void) {
   bool foundTime  = false;
   bool foundIBTag = false;
   bool foundUGTag = false;
+  int skipPieces = 0;  // Pieces belonging to preceding ranks [aggregated files]
   string str;
   stringstream ss;
   vector<double> tmpIblank;
@@ -1839,6 +2589,10 @@ void solver::readRestartFile(void) {
         tmpIblank.assign(Geo->nEles,NORMAL);
         for (int i=0; i<Geo->nEles; i++)
           ss >> tmpIblank[i];
+      } else if (str.compare("RANK_PIECES")==0) {
+        int rank, nPieces;
+        while (ss >> rank >> nPieces && rank < params->rank)
+          skipPieces += nPieces;
       }
     } else if (str.compare("<UnstructuredGrid>")==0) {
       foundUGTag = true;
@@ -1855,6 +2609,12 @@ void solver::readRestartFile(void) {
   if (params->meshType == OVERSET_MESH and !foundIBTag)
     cout << "WARNING: IblankCell data not found in restart file for rank " << params->rank << endl;
 
+  // Skip over the data of any preceding ranks in an aggregated file
+  while (skipPieces > 0 && getline(dataFile,str)) {
+    if (str.find("</Piece>") != string::npos)
+      skipPieces--;
+  }
+
   /* -- Set the geometry to the current restart time -- */
 
   moveMesh(0);
@@ -1886,9 +2646,39 @@ void solver::readRestartFile(void) {
 
   dataFile.close();
 
+  if (params->calcStats)
+    readStatsFile();
+
   if (params->rank==0) cout << "Solver: Done reading restart file." << endl;
 }
 
+void solver::readStatsFile(void)
+{
+  char fileNameC[256];
+  string fileName = params->dataFileName;
+#ifndef _NO_MPI
+  sprintf(fileNameC,"%s_%.09d/%s_%.09d_%d.stats",&fileName[0],params->restartIter,&fileName[0],params->restartIter,params->rank);
+#else
+  sprintf(fileNameC,"%s_%.09d.stats",&fileName[0],params->restartIter);
+#endif
+
+  ifstream statsFile(fileNameC, ifstream::binary);
+
+  int dims[3] = {0,0,0};
+  if (statsFile.is_open())
+    statsFile.read((char*)dims, 3*sizeof(int));
+
+  if (dims[0] != (int)nSpts || dims[1] != (int)nEles || dims[2] != (int)nStats) {
+    if (params->rank == 0)
+      cout << "WARNING: Running statistics not found in " << fileNameC << "; restarting the statistics." << endl;
+    return;
+  }
+
+  statsFile.read((char*)&statsTime, sizeof(double));
+  statsFile.read((char*)&statsLastTime, sizeof(double));
+  statsFile.read((char*)stats_spts.getData(), stats_spts.getSize()*sizeof(double));
+}
+
 void solver::initializeSolution(bool PMG)
 {
   if (params->rank==0) cout << "Solver: Initializing Solution... " << flush;
@@ -1916,8 +2706,7 @@ void solver::initializeSolution(bool PMG)
       OComm->matchUnblankCells(eles,Geo->fringeCells,Geo->eleMap,params->quadOrder);
       OComm->performGalerkinProjection(eles,opers,Geo->eleMap,order);
     } else {
-      if (params->nDims==2)
-        getBoundingBox(Geo->xv,Geo->minPt,Geo->maxPt);
+      getBoundingBox(Geo->xv,Geo->minPt,Geo->maxPt);
       int nPtsFace = order+1;
       if (nDims==3) nPtsFace *= order+1;
       if (params->oversetMethod != 2)
@@ -1987,7 +2776,7 @@ vector<double> solver::integrateError(void)
     auto &C = U_qpts(0,0,0);
 
   #ifdef _OMP
-    omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+    omp_blocked_gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
                 1.0, &A, k, &B, n, 0.0, &C, n);
   #else
     cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
@@ -1998,7 +2787,7 @@ vector<double> solver::integrateError(void)
     auto &B1 = detJac_spts(0,0);
     auto &C1 = detJac_qpts(0,0);
   #ifdef _OMP
-    omp_blocked_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+    omp_blocked_gemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
                 1.0, &A, k, &B1, n, 0.0, &C1, n);
   #else
     cblas_dgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k,
@@ -29,6 +29,8 @@
 
 #include "solver.hpp"
 
+#include <unordered_map>
+
 /* ---- My New Overset Grid Functions ---- */
 
 void solver::oversetFieldInterp(void)
@@ -51,7 +53,7 @@ void solver::oversetInterp(void)
 #ifndef _NO_MPI
   if (params->oversetMethod == 2) return;
 
-  OComm->exchangeOversetData(eles,opers,Geo->eleMap);
+  OComm->sendOversetData(eles,opers,Geo->eleMap);
 #endif
 }
 
@@ -60,7 +62,7 @@ void solver::oversetInterp_gradient(void)
 #ifndef _NO_MPI
   if (params->oversetMethod == 2) return;
 
-  OComm->exchangeOversetGradient(eles,opers,Geo->eleMap);
+  OComm->sendOversetGradient(eles,opers,Geo->eleMap);
 #endif
 }
 
@@ -78,10 +80,10 @@ void solver::setupOverset(void)
   }
   else {
     OComm = Geo->OComm;
-
-    getBoundingBox(Geo->xv,Geo->minPt,Geo->maxPt);
   }
 
+  getBoundingBox(Geo->xv,Geo->minPt,Geo->maxPt);
+
   if (params->oversetMethod == 2 && !params->projection) {
     OComm->setupFringeCellPoints(eles,Geo->fringeCells,Geo->eleMap);
   } else if (params->oversetMethod != 2) {
@@ -94,6 +96,186 @@ void solver::setupOverset(void)
 #endif
 }
 
+void solver::projectUnblankCells(void)
+{
+#ifndef _NO_MPI
+  if (params->projection) {
+    /* --- Use LGP with supermeshing; NOTE: For linear shape funcs only --- */
+    OComm->matchUnblankCells(eles,Geo->unblankCells,Geo->eleMap,params->quadOrder);
+    OComm->performGalerkinProjection(eles,opers,Geo->eleMap,order);
+  }
+  else {
+    /* --- Use collocation projection; Use for nonlinear shape funcs --- */
+    OComm->setupFringeCellPoints(eles,Geo->unblankCells,Geo->eleMap);
+    OComm->matchOversetPoints(eles,Geo->eleMap,Geo->minPt,Geo->maxPt);
+    OComm->exchangeOversetData(eles,opers,Geo->eleMap);
+    OComm->transferEleData(eles,Geo->unblankCells,Geo->eleMap);
+  }
+#endif
+}
+
+void solver::rebalance(void)
+{
+#ifndef _NO_MPI
+  if (params->meshType != OVERSET_MESH || !params->motion || params->nproc == 1) return;
+
+  /* --- Work done by each rank since the last check: time in update(), less
+   * the time spent waiting on the other ranks & grids --- */
+
+  // [The MPI faces are rebuilt by a repartition, so collect their wait times here]
+  for (auto &mface:mpiFaces) {
+    mpiWaitTime += mface->waitTime;
+    mface->waitTime = 0;
+  }
+
+  double busyTime = updateTime - waitTime - mpiWaitTime;
+  if (OComm != NULL)
+    busyTime -= OComm->waitTime;
+
+  double dBusy = busyTime - lastBusyTime;
+  lastBusyTime = busyTime;
+
+  vector<double> busy_rank(nprocPerGrid);
+  MPI_Allgather(&dBusy,1,MPI_DOUBLE,busy_rank.data(),1,MPI_DOUBLE,Geo->gridComm);
+
+  double maxBusy = getMax(busy_rank);
+  double meanBusy = getSum(busy_rank) / nprocPerGrid;
+
+  int repartition = (nprocPerGrid > 1 && maxBusy > params->rebalanceTol*meanBusy);
+
+  // The overset connectivity of all grids is rebuilt together
+  int nRepart;
+  MPI_Allreduce(&repartition,&nRepart,1,MPI_INT,MPI_SUM,MPI_COMM_WORLD);
+
+  if (nRepart == 0) return;
+
+  if (repartition && gridRank == 0)
+    cout << "Solver: Grid " << gridID << ": max/mean busy time = " << maxBusy/meanBusy << "; repartitioning" << endl;
+
+  // Any pending time-step reduction belongs to the old elements
+  if (dtPending) {
+    MPI_Wait(&dtRequest, MPI_STATUS_IGNORE);
+    dtPending = false;
+  }
+
+  geo *newGeo = new geo;
+  newGeo->setupRebalance(*Geo,repartition);
+
+  /* --- Send the solution [& running statistics] in each active cell to the cell's new owner --- */
+
+  int nVarsU = nSpts*nFields;
+  int nVarsS = (params->calcStats) ? nSpts*nStats : 0;
+  int nVars = nVarsU + nVarsS;
+
+  vector<int> dest(nEles), nCellsSend(nprocPerGrid,0), nCellsRecv(nprocPerGrid);
+  for (uint i=0; i<nEles; i++) {
+    dest[i] = (nprocPerGrid > 1) ? newGeo->epart[eles[i]->IDg] : 0;
+    nCellsSend[dest[i]]++;
+  }
+
+  MPI_Alltoall(nCellsSend.data(),1,MPI_INT,nCellsRecv.data(),1,MPI_INT,Geo->gridComm);
+
+  vector<int> sendDisp(nprocPerGrid+1,0), recvDisp(nprocPerGrid+1,0);
+  for (int p=0; p<nprocPerGrid; p++) {
+    sendDisp[p+1] = sendDisp[p] + nCellsSend[p];
+    recvDisp[p+1] = recvDisp[p] + nCellsRecv[p];
+  }
+
+  int nCellsIn = recvDisp[nprocPerGrid];
+
+  vector<int> IDg_out(nEles), IDg_in(nCellsIn);
+  vector<double> U_out(nEles*nVars), U_in(nCellsIn*nVars);
+
+  vector<int> ind(sendDisp.begin(),sendDisp.end()-1);
+  for (uint i=0; i<nEles; i++) {
+    int j = ind[dest[i]]++;
+    IDg_out[j] = eles[i]->IDg;
+    for (int spt=0; spt<nSpts; spt++)
+      for (int k=0; k<nFields; k++)
+        U_out[j*nVars+spt*nFields+k] = eles[i]->U_spts(spt,k);
+    for (int spt=0; spt<nSpts && nVarsS>0; spt++)
+      for (uint k=0; k<nStats; k++)
+        U_out[j*nVars+nVarsU+spt*nStats+k] = stats_spts(spt,eles[i]->sID,k);
+  }
+
+  MPI_Alltoallv(IDg_out.data(),nCellsSend.data(),sendDisp.data(),MPI_INT,
+                IDg_in.data(),nCellsRecv.data(),recvDisp.data(),MPI_INT,Geo->gridComm);
+
+  for (int p=0; p<nprocPerGrid; p++) {
+    nCellsSend[p] *= nVars;  sendDisp[p] *= nVars;
+    nCellsRecv[p] *= nVars;  recvDisp[p] *= nVars;
+  }
+
+  MPI_Alltoallv(U_out.data(),nCellsSend.data(),sendDisp.data(),MPI_DOUBLE,
+                U_in.data(),nCellsRecv.data(),recvDisp.data(),MPI_DOUBLE,Geo->gridComm);
+
+  /* --- Rebuild the elements, faces & overset connectivity on the new partition --- */
+
+  // Keep the totals reported by writeGridBalance
+  waitTime += OComm->waitTime;
+
+  MPI_Comm_free(&Geo->gridComm);
+  delete Geo;
+  Geo = newGeo;
+  tg = Geo->tg;
+
+  Geo->setupElesFaces(params,eles,faces,mpiFaces,overFaces);
+
+  nEles = eles.size();
+
+  setupArrays();
+
+  setupGeometry();
+
+  updateGridVSptsFpts();
+
+  updateTransforms();
+
+  setupElesFaces();
+
+  setupOverset();
+
+  finishMpiSetup();
+
+  setupTaskGraph();
+
+  setupProbes();
+
+  calcWallDistance();
+
+  /* --- Copy in the migrated solution; cells which were blanked before the
+   * rebuild are filled from the other grids --- */
+
+  unordered_map<int,int> IDg2e;
+  for (uint i=0; i<nEles; i++)
+    IDg2e[eles[i]->IDg] = i;
+
+  vector<char> filled(nEles,0);
+  for (int j=0; j<nCellsIn; j++) {
+    auto it = IDg2e.find(IDg_in[j]);
+    if (it == IDg2e.end()) continue; // Now a hole cell
+
+    int i = it->second;
+    for (int spt=0; spt<nSpts; spt++)
+      for (int k=0; k<nFields; k++)
+        eles[i]->U_spts(spt,k) = U_in[j*nVars+spt*nFields+k];
+    for (int spt=0; spt<nSpts && nVarsS>0; spt++)
+      for (uint k=0; k<nStats; k++)
+        stats_spts(spt,eles[i]->sID,k) = U_in[j*nVars+nVarsU+spt*nStats+k];
+    filled[i] = 1;
+  }
+
+  Geo->unblankCells.clear();
+  for (uint i=0; i<nEles; i++)
+    if (!filled[i])
+      Geo->unblankCells.insert(eles[i]->ID);
+
+  projectUnblankCells();
+
+  Geo->unblankCells.clear();
+#endif
+}
+
 vector<double> solver::integrateErrorOverset(void)
 {
 #ifndef _NO_MPI
@@ -179,6 +361,20 @@ void solver::insertElement(uint ele_ind)
     src_spts.add_dim_1(ele_ind, 0.);
   }
 
+  // The new element's volume is set once its transforms are computed [updateTransforms]
+  if (params->dtType != 0)
+  {
+    vol_eles.insert(vol_eles.begin()+ele_ind, 0.);
+    waveSp_faces.add_dim_0(ele_ind, 0.);
+  }
+
+  // A newly-unblanked cell starts its statistics from zero
+  if (params->calcStats)
+  {
+    stats_spts.add_dim_1(ele_ind, 0.);
+    stats_ppts.add_dim_1(ele_ind, 0.);
+  }
+
   tempVars_spts.add_dim_1(ele_ind, 0.);
   tempVars_fpts.add_dim_1(ele_ind, 0.);
 
@@ -252,6 +448,18 @@ void solver::removeElement(uint ele_ind)
     src_spts.remove_dim_1(ele_ind);
   }
 
+  if (params->dtType != 0)
+  {
+    vol_eles.erase(vol_eles.begin()+ele_ind);
+    waveSp_faces.remove_dim_0(ele_ind);
+  }
+
+  if (params->calcStats)
+  {
+    stats_spts.remove_dim_1(ele_ind);
+    stats_ppts.remove_dim_1(ele_ind);
+  }
+
   tempVars_spts.remove_dim_1(ele_ind);
   tempVars_fpts.remove_dim_1(ele_ind);
 
@@ -137,19 +137,25 @@ void superMesh::buildSuperMeshTri(void)
   faces.insertRow(facePts);
   normals[3] = getEdgeNormal(facePts,xc);
 
-  // Step 3: Use the faces to clip the tets
+  // Step 3: Use the faces to clip the tris
+  // [Ping-pong between the output list and a per-thread scratch list; each clip adds at most 1 tri]
+  static thread_local vector<triangle> newTris;
+  static thread_local vector<int> newParents;
   for (uint i=0; i<faces.getDim0(); i++) {
-    vector<triangle> newTris;
-    vector<int> newParents;
+    point fc = (faces(i,0) + faces(i,1)) / 2.;
+    newTris.resize(2*tris.size());
+    newParents.resize(2*tris.size());
+    int n = 0;
     for (uint j=0; j<tris.size(); j++) {
-      triangle tri = tris[j];
-      auto tmpTris = clipTri(tri, faces.getRow(i), normals[i]);
-
-      newTris.insert(newTris.end(),tmpTris.begin(),tmpTris.end());
-      newParents.insert(newParents.end(),tmpTris.size(),parents[j]);
+      int nNew = clipTri(tris[j], fc, normals[i], &newTris[n]);
+      for (int k=0; k<nNew; k++)
+        newParents[n+k] = parents[j];
+      n += nNew;
     }
-    tris = newTris;
-    parents = newParents;
+    newTris.resize(n);
+    newParents.resize(n);
+    tris.swap(newTris);
+    parents.swap(newParents);
   }
 }
 
@@ -197,17 +203,27 @@ void superMesh::buildSuperMeshTet(void)
   normals[5] = getFaceNormalQuad(facePts,xc);
 
   // Step 3: Use the faces to clip the tets
+  // [Ping-pong between the output list and a per-thread scratch list; each clip makes at most 3 tets]
+  static thread_local vector<tetra> newTets;
+  static thread_local vector<int> newParents;
   for (uint i=0; i<faces.getDim0(); i++) {
-    vector<tetra> newTets;
-    vector<int> newParents;
+    point fc;
+    for (int j=0; j<4; j++)
+      fc += faces(i,j);
+    fc /= 4.;
+    newTets.resize(3*tets.size());
+    newParents.resize(3*tets.size());
+    int n = 0;
     for (uint j=0; j<tets.size(); j++) {
-      tetra tet = tets[j];
-      auto tmpTets = clipTet(tet, faces.getRow(i), normals[i]);
-      newTets.insert(newTets.end(),tmpTets.begin(),tmpTets.end());
-      newParents.insert(newParents.end(),tmpTets.size(),parents[j]);
+      int nNew = clipTet(tets[j], fc, normals[i], &newTets[n]);
+      for (int k=0; k<nNew; k++)
+        newParents[n+k] = parents[j];
+      n += nNew;
     }
-    tets = newTets;
-    parents = newParents;
+    newTets.resize(n);
+    newParents.resize(n);
+    tets.swap(newTets);
+    parents.swap(newParents);
   }
 }
 
@@ -425,6 +441,20 @@ void superMesh::printQuadPoints(vector<double> &vals)
   mesh.close();
 }
 
+void buildSuperMeshes(vector<superMesh> &meshes, vector<vector<point>> &targets, vector<Array2D<point>> &donors, int order, int nDims, int rank)
+{
+  int nMeshes = targets.size();
+  meshes.assign(nMeshes,superMesh());
+
+#pragma omp parallel for schedule(dynamic)
+  for (int i=0; i<nMeshes; i++) {
+    meshes[i].rank = rank;
+    meshes[i].ID = i;
+    meshes[i].setup(targets[i],donors[i],order,nDims);
+    meshes[i].setupQuadrature();
+  }
+}
+
 vector<tetra> splitHexIntoTets(const vector<point> &hexNodes)
 {
   vector<tetra> newTets(5);
@@ -440,252 +470,221 @@ vector<tetra> splitHexIntoTets(const vector<point> &hexNodes)
 
 vector<tetra> clipTet(tetra &tet, const vector<point> &clipFace, Vec3 &norm)
 {
-  /* --- WARNING: Assuming a linear, planar face --- */
-
-  vector<tetra> outTets;
-
   // Get face centroid
   point xc;
   for (auto &pt:clipFace)
     xc += pt;
   xc /= clipFace.size();
 
-  set<int> deadPts;
+  vector<tetra> outTets(3);
+  outTets.resize(clipTet(tet, xc, norm, outTets.data()));
+
+  return outTets;
+}
+
+int clipTet(const tetra &tet, point xc, Vec3 norm, tetra *outTets)
+{
+  /* --- WARNING: Assuming a linear, planar face --- */
+
+  array<point,4> nodes = tet.nodes;
+
+  // Check each point of tetra to see which must be removed
+  bool dead[4];
+  int nDead = 0;
   for (int i=0; i<4; i++) {
-    // Check each point of tetra to see which must be removed
-    Vec3 dx = tet.nodes[i] - xc;
-    double dot = dx*norm;
-    if (dot > 0) // Point lies on cut-side of clipping plane
-      deadPts.insert(i);
+    Vec3 dx = nodes[i] - xc;
+    dead[i] = (dx*norm > 0); // Point lies on cut-side of clipping plane
+    nDead += dead[i];
   }
 
+  // Edge points opposite each node, oriented so that the new tets are right-handed
+  static const int flipTet1[4][3] = {{1,3,2}, {0,2,3}, {0,3,1}, {0,1,2}};
+
   /*
    * Perform the clipping and subdivide the new volume into new tets
    * Only 3 cases in which the clipping can occur
    * New points are created at the intersections of the original tet's edges
    * with the clipping plane: http://geomalgorithms.com/a05-_intersect-1.html
    */
-  switch (deadPts.size()) {
+  switch (nDead) {
     case 0: {
       // No intersection
-      outTets.push_back(tet);
-      break;
+      outTets[0].nodes = nodes;
+      outTets[0].donorID = tet.donorID;
+      return 1;
     }
 
     case 1: {
       // Remove 1 point to get a prism; split prism into 3 new tets
-      int kill = *(deadPts.begin());  // The point to remove
+      int kill = 0;  // The point to remove
+      while (!dead[kill]) kill++;
 
       // Get the new points by intersecting the tet's edges with the clipping plane
       // Have to be careful about orientation of final tet
-      map<int,array<int,3>> flipTet;
-      flipTet[0] = {{1,3,2}};  flipTet[1] = {{0,2,3}};
-      flipTet[2] = {{0,3,1}};  flipTet[3] = {{0,1,2}};
-      array<int,3> ePts = flipTet[kill];
+      const int *ePts = flipTet1[kill];
 
       // Find the intersection points
       array<point,3> newPts;
       for (int i=0; i<3; i++) {
-        Vec3 ab = tet.nodes[ePts[i]] - tet.nodes[kill];
-        Vec3 ac = xc - tet.nodes[kill];
-        newPts[i] = ab*((norm*ac)/(norm*ab)) + tet.nodes[kill];
+        Vec3 ab = nodes[ePts[i]] - nodes[kill];
+        Vec3 ac = xc - nodes[kill];
+        newPts[i] = ab*((norm*ac)/(norm*ab)) + nodes[kill];
       }
 
-      outTets.resize(3);
-      outTets[0].nodes = {{tet.nodes[ePts[0]], tet.nodes[ePts[1]], newPts[0], tet.nodes[ePts[2]]}};
-      outTets[1].nodes = {{tet.nodes[ePts[2]], newPts[0], newPts[2], newPts[1]}};
-      outTets[2].nodes = {{tet.nodes[ePts[1]], tet.nodes[ePts[2]], newPts[1],newPts[0]}};
-      break;
+      outTets[0].nodes = {{nodes[ePts[0]], nodes[ePts[1]], newPts[0], nodes[ePts[2]]}};
+      outTets[1].nodes = {{nodes[ePts[2]], newPts[0], newPts[2], newPts[1]}};
+      outTets[2].nodes = {{nodes[ePts[1]], nodes[ePts[2]], newPts[1],newPts[0]}};
+      return 3;
     }
 
     case 2: {
       // Tet cut in half through 4 edges; split into 3 new tets
-      // Get the points we're keeping and 'killing'
-      array<int,2> kill, keep;
-      int m=0, n=0;
-      for (int i=0; i<4; i++) {
-        if (deadPts.count(i)) {
-          kill[m] = i;
-          m++;
-        }
-        else {
-          keep[n] = i;
-          n++;
-        }
-      }
+      // Get the points we're keeping
+      int keep[2];
+      int n=0;
+      for (int i=0; i<4; i++)
+        if (!dead[i]) keep[n++] = i;
 
       /* Re-orient tet (shuffle nodes) based on kept nodes so that
        * clipping becomes standardized; 'base case' is keeping {0,1}
        * One possible case for each edge being removed */
-      map<array<int,2>,array<int,4>> flipTet;
-      flipTet[{{0,1}}] = {{0,1,2,3}};  flipTet[{{0,2}}] = {{0,2,3,1}};
-      flipTet[{{0,3}}] = {{0,3,1,2}};  flipTet[{{1,2}}] = {{1,2,0,3}};
-      flipTet[{{1,3}}] = {{1,3,2,0}};  flipTet[{{2,3}}] = {{2,3,0,1}};
-      array<int,4> ind = flipTet[keep];
-
-      // Intersect the plane with the edges to get the new points
+      int ind[4];
+      if      (keep[0]==0 && keep[1]==1) { ind[0]=0; ind[1]=1; ind[2]=2; ind[3]=3; }
+      else if (keep[0]==0 && keep[1]==2) { ind[0]=0; ind[1]=2; ind[2]=3; ind[3]=1; }
+      else if (keep[0]==0 && keep[1]==3) { ind[0]=0; ind[1]=3; ind[2]=1; ind[3]=2; }
+      else if (keep[0]==1 && keep[1]==2) { ind[0]=1; ind[1]=2; ind[2]=0; ind[3]=3; }
+      else if (keep[0]==1 && keep[1]==3) { ind[0]=1; ind[1]=3; ind[2]=2; ind[3]=0; }
+      else                               { ind[0]=2; ind[1]=3; ind[2]=0; ind[3]=1; }
+
+      // Intersect the plane with the edges 0-3, 1-3, 1-2, 0-2 to get the new points
+      static const int edges[4][2] = {{0,3}, {1,3}, {1,2}, {0,2}};
       array<point,4> newPts;
-      point a,b;
-      Vec3 ab,ac;
-
-      // Edge 0-3
-      a = tet.nodes[ind[0]];
-      b = tet.nodes[ind[3]];
-      ab = b - a;
-      ac = xc - a;
-      newPts[0] = ab*((norm*ac)/(norm*ab)) + a;
-
-      // Edge 1-3
-      a = tet.nodes[ind[1]];
-      b = tet.nodes[ind[3]];
-      ab = b - a;
-      ac = xc - a;
-      newPts[1] = ab*((norm*ac)/(norm*ab)) + a;
-
-      // Edge 1-2
-      a = tet.nodes[ind[1]];
-      b = tet.nodes[ind[2]];
-      ab = b - a;
-      ac = xc - a;
-      newPts[2] = ab*((norm*ac)/(norm*ab)) + a;
-
-      // Edge 0-2
-      a = tet.nodes[ind[0]];
-      b = tet.nodes[ind[2]];
-      ab = b - a;
-      ac = xc - a;
-      newPts[3] = ab*((norm*ac)/(norm*ab)) + a;
+      for (int i=0; i<4; i++) {
+        point a = nodes[ind[edges[i][0]]];
+        point b = nodes[ind[edges[i][1]]];
+        Vec3 ab = b - a;
+        Vec3 ac = xc - a;
+        newPts[i] = ab*((norm*ac)/(norm*ab)) + a;
+      }
 
       // Setup the new tets
-      outTets.resize(3);
-      outTets[0].nodes = {{tet.nodes[ind[1]],newPts[0],newPts[3],tet.nodes[ind[0]]}};
-      outTets[1].nodes = {{newPts[0],newPts[3],newPts[1],tet.nodes[ind[1]]}};
-      outTets[2].nodes = {{newPts[1],newPts[3],newPts[2],tet.nodes[ind[1]]}};
-      break;
+      outTets[0].nodes = {{nodes[ind[1]],newPts[0],newPts[3],nodes[ind[0]]}};
+      outTets[1].nodes = {{newPts[0],newPts[3],newPts[1],nodes[ind[1]]}};
+      outTets[2].nodes = {{newPts[1],newPts[3],newPts[2],nodes[ind[1]]}};
+      return 3;
     }
 
     case 3: {
       // The opposite of case 1; new tet is one corner of original tet
-      int keep = -1;
-      for (int i=0; i<4; i++) {
-        if (!deadPts.count(i)) {
-          keep = i;
-          break;
-        }
-      }
+      int keep = 0;
+      while (dead[keep]) keep++;
 
       // Get the new points by intersecting the tet's edges with the clipping plane
       // Have to be careful about orientation of final tet, so map to a 'standard' orientation
-      map<int,array<int,3>> flipTet;
-      flipTet[0] = {{1,3,2}};  flipTet[1] = {{0,2,3}};
-      flipTet[2] = {{0,3,1}};  flipTet[3] = {{0,1,2}};
-      array<int,3> ePts = flipTet[keep];
+      const int *ePts = flipTet1[keep];
 
       // Setup outgoing tet; node 3 is the 'kept' node
       // Find the intersection points
-      outTets.resize(1);
-      outTets[0].nodes[3] = tet.nodes[keep];
+      outTets[0].nodes[3] = nodes[keep];
       for (int i=0; i<3; i++) {
-        Vec3 ab = tet.nodes[ePts[i]] - tet.nodes[keep];
-        Vec3 ac = xc - tet.nodes[keep];
-        outTets[0].nodes[i] = ab*((norm*ac)/(norm*ab)) + tet.nodes[keep];
+        Vec3 ab = nodes[ePts[i]] - nodes[keep];
+        Vec3 ac = xc - nodes[keep];
+        outTets[0].nodes[i] = ab*((norm*ac)/(norm*ab)) + nodes[keep];
       }
-      break;
+      return 1;
     }
 
-    case 4: {
+    default: {
       // Entire tet is beyond clipping face
-      break;
+      return 0;
     }
   }
-
-  return outTets;
 }
 
 
 vector<triangle> clipTri(triangle &tri, const vector<point> &clipEdge, Vec3 &norm)
 {
-  /* --- WARNING: Assuming a linear edge --- */
-
-  vector<triangle> outTris;
-
   // Get face centroid
   point xc = clipEdge[0];
   xc += clipEdge[1];
   xc /= 2.;
 
-  set<int> deadPts;
+  vector<triangle> outTris(2);
+  outTris.resize(clipTri(tri, xc, norm, outTris.data()));
+
+  return outTris;
+}
+
+int clipTri(const triangle &tri, point xc, Vec3 norm, triangle *outTris)
+{
+  /* --- WARNING: Assuming a linear edge --- */
+
+  array<point,3> nodes = tri.nodes;
+
+  // Check each point of triangle to see which must be removed
+  bool dead[3];
+  int nDead = 0;
   for (int i=0; i<3; i++) {
-    // Check each point of triangle to see which must be removed
-    Vec3 dx = tri.nodes[i] - xc;
-    double dot = dx*norm;
-    if (dot > 0) // Point lies on cut-side of clipping plane
-      deadPts.insert(i);
+    Vec3 dx = nodes[i] - xc;
+    dead[i] = (dx*norm > 0); // Point lies on cut-side of clipping plane
+    nDead += dead[i];
   }
 
+  // The other two points of the triangle for each node, in 'standard' order
+  static const int flipTri[3][2] = {{1,2}, {2,0}, {0,1}};
+
   /*
    * Perform the clipping and subdivide the new volume into new tris
    */
-  switch (deadPts.size()) {
+  switch (nDead) {
     case 0: {
       // No intersection.
-      outTris.push_back(tri);
-      break;
+      outTris[0].nodes = nodes;
+      outTris[0].donorID = tri.donorID;
+      return 1;
     }
     case 1: {
       // Removing one corner of tri
-      int kill = *(deadPts.begin());  // The point to remove
+      int kill = 0;  // The point to remove
+      while (!dead[kill]) kill++;
 
       // Get the points being kept; map to a 'standard' triangle
-      map<int,array<int,2>> flipTri;
-      flipTri[0] = {{1,2}};  flipTri[1] = {{2,0}}; flipTri[2] = {{0,1}};
-      array<int,2> ePts = flipTri[kill];
+      const int *ePts = flipTri[kill];
 
       // Find the cutting-plane intersection points
-      Vec3 ab = tri.nodes[ePts[0]] - tri.nodes[kill];
-      Vec3 ac = xc - tri.nodes[kill];
-      point newPt1 = ab*(norm*ac)/(norm*ab) + tri.nodes[kill];
+      Vec3 ab = nodes[ePts[0]] - nodes[kill];
+      Vec3 ac = xc - nodes[kill];
+      point newPt1 = ab*(norm*ac)/(norm*ab) + nodes[kill];
 
-      ab = tri.nodes[ePts[1]] - tri.nodes[kill];
-      point newPt2 = ab*(norm*ac)/(norm*ab) + tri.nodes[kill];
+      ab = nodes[ePts[1]] - nodes[kill];
+      point newPt2 = ab*(norm*ac)/(norm*ab) + nodes[kill];
 
-      outTris.resize(2);
-      outTris[0].nodes = {{tri.nodes[ePts[0]],tri.nodes[ePts[1]],newPt1}};
-      outTris[1].nodes = {{tri.nodes[ePts[1]],newPt2,newPt1}};
-      break;
+      outTris[0].nodes = {{nodes[ePts[0]],nodes[ePts[1]],newPt1}};
+      outTris[1].nodes = {{nodes[ePts[1]],newPt2,newPt1}};
+      return 2;
     }
     case 2: {
       // Keeping one corner of tri
-      int keep = -1;
-      for (int i=0; i<3; i++) {
-        if (!deadPts.count(i)) {
-          keep = i;
-          break;
-        }
-      }
+      int keep = 0;
+      while (dead[keep]) keep++;
 
-      map<int,array<int,2>> flipTri;
-      flipTri[0] = {{1,2}};  flipTri[1] = {{2,0}}; flipTri[2] = {{0,1}};
-      array<int,2> ePts = flipTri[keep];
+      const int *ePts = flipTri[keep];
 
       // Setup outgoing tri; node 2 is the 'kept' node
       // Find the intersection points
-      outTris.resize(1);
-      outTris[0].nodes[2] = tri.nodes[keep];
+      outTris[0].nodes[2] = nodes[keep];
       for (int i=0; i<2; i++) {
-        Vec3 ab = tri.nodes[ePts[i]] - tri.nodes[keep];
-        Vec3 ac = xc - tri.nodes[keep];
-        outTris[0].nodes[i] = ab*((norm*ac)/(norm*ab)) + tri.nodes[keep];
+        Vec3 ab = nodes[ePts[i]] - nodes[keep];
+        Vec3 ac = xc - nodes[keep];
+        outTris[0].nodes[i] = ab*((norm*ac)/(norm*ab)) + nodes[keep];
       }
-      break;
+      return 1;
     }
-    case 3: {
+    default: {
       // Entire tri is beyond clipping face
-      break;
+      return 0;
     }
   }
-
-  return outTris;
 }
 
 
@@ -0,0 +1,318 @@
+/*!
+ * \file modal2vtu.cpp
+ * \brief Convert a Flurry++ modal-coefficient (.modal) file into a ParaView .vtu file
+ * \author - Jacob Crabill
+ *           Aerospace Computing Laboratory (ACL)
+ *           Aero/Astro Department. Stanford University
+ *
+ * \version 1.0.0
+ *
+ * Fux Reconstruction in C++ (Flurry++) Code
+ * Copyright (C) 2015 Jacob Crabill
+ *
+ * Flurry++ is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Flurry++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with Flurry++; if not, write to the Free Software Foundation, Inc.,
+ * 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA..
+ *
+ * Usage: modal2vtu <input.modal> [output.vtu]
+ *
+ * Reconstructs the solution and geometry from their Legendre modes at the
+ * same plot points used by writeParaview [element corners & solution points],
+ * so the output matches a plotType = 1 file up to any modal truncation
+ * [the conserved variables are reconstructed, then converted to primitives,
+ * whereas writeParaview extrapolates the primitives themselves].
+ * Modes are ordered as in getModeIndices() [polynomials.cpp]; missing
+ * (truncated) modes are taken as zero.
+ */
+
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+static double Legendre(double r, int mode)
+{
+  if (mode == 0) return 1.0;
+  if (mode == 1) return r;
+
+  double p0 = 1.0, p1 = r;
+  for (int n = 2; n <= mode; n++) {
+    double p2 = ((2*n-1)*r*p1 - (n-1)*p0) / n;
+    p0 = p1;
+    p1 = p2;
+  }
+
+  return p1;
+}
+
+static vector<array<int,3>> getModeIndices(int nDims, int order)
+{
+  vector<array<int,3>> modes;
+
+  int kMax = (nDims == 3) ? order : 0;
+  for (int s = 0; s <= nDims*order; s++) {
+    for (int k = 0; k <= kMax; k++) {
+      for (int j = 0; j <= order; j++) {
+        int i = s - j - k;
+        if (i >= 0 && i <= order)
+          modes.push_back({{i, j, k}});
+      }
+    }
+  }
+
+  return modes;
+}
+
+template<typename T>
+static void readBin(ifstream &file, T *data, size_t n)
+{
+  file.read((char*)data, n*sizeof(T));
+  if (!file) {
+    cerr << "modal2vtu: unexpected end of file." << endl;
+    exit(1);
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  if (argc < 2) {
+    cout << "Usage: " << argv[0] << " <input.modal> [output.vtu]" << endl;
+    return 1;
+  }
+
+  string inName = argv[1];
+  string outName;
+  if (argc > 2) {
+    outName = argv[2];
+  } else {
+    outName = inName;
+    size_t dot = outName.rfind(".modal");
+    if (dot != string::npos) outName.erase(dot);
+    outName += ".vtu";
+  }
+
+  ifstream inFile(inName, ifstream::binary);
+  if (!inFile.is_open()) {
+    cerr << "modal2vtu: unable to open " << inName << endl;
+    return 1;
+  }
+
+  /* --- Read the header --- */
+
+  char magic[8];
+  readBin(inFile, magic, 8);
+  if (strncmp(magic, "FLRYMODL", 8)) {
+    cerr << "modal2vtu: " << inName << " is not a Flurry++ modal file." << endl;
+    return 1;
+  }
+
+  int header[7];
+  readBin(inFile, header, 7);
+  int version = header[0], nDims = header[1], order = header[2], nFields = header[3];
+  int equation = header[4], nEles = header[5], iter = header[6];
+
+  if (version != 1) {
+    cerr << "modal2vtu: unsupported file version " << version << endl;
+    return 1;
+  }
+
+  double time, gamma;
+  readBin(inFile, &time, 1);
+  readBin(inFile, &gamma, 1);
+
+  int nPpts1D = order+3;
+  vector<double> pts1D(nPpts1D);
+  readBin(inFile, pts1D.data(), nPpts1D);
+
+  /* --- Tabulate each mode at the plot points --- */
+
+  auto modes = getModeIndices(nDims, order);
+  int nSpts = modes.size();
+
+  int nPpts = (nDims == 2) ? nPpts1D*nPpts1D : nPpts1D*nPpts1D*nPpts1D;
+  int nSubCells = (nDims == 2) ? (nPpts1D-1)*(nPpts1D-1) : (nPpts1D-1)*(nPpts1D-1)*(nPpts1D-1);
+
+  vector<double> basis(nPpts*nSpts); // [ppt][mode]
+  for (int ppt = 0; ppt < nPpts; ppt++) {
+    int i = ppt % nPpts1D;
+    int j = (ppt / nPpts1D) % nPpts1D;
+    int k = ppt / (nPpts1D*nPpts1D);
+    for (int m = 0; m < nSpts; m++) {
+      double val = Legendre(pts1D[i], modes[m][0]) * Legendre(pts1D[j], modes[m][1]);
+      if (nDims == 3)
+        val *= Legendre(pts1D[k], modes[m][2]);
+      basis[ppt*nSpts+m] = val;
+    }
+  }
+
+  ofstream dataFile(outName);
+  dataFile.precision(16);
+
+  dataFile << "<?xml version=\"1.0\" ?>" << endl;
+  dataFile << "<VTKFile type=\"UnstructuredGrid\" version=\"0.1\" byte_order=\"LittleEndian\" compressor=\"vtkZLibDataCompressor\">" << endl;
+  dataFile << "<!-- TIME " << time << " -->" << endl;
+  dataFile << "<!-- ITER " << iter << " -->" << endl;
+  dataFile << "	<UnstructuredGrid>" << endl;
+
+  vector<double> pos_modes(nDims*nSpts), U_modes(nFields*nSpts);
+  vector<double> pos(nPpts*nDims), V(nPpts*nFields);
+
+  for (int ele = 0; ele < nEles; ele++) {
+    int nModes;
+    readBin(inFile, &nModes, 1);
+    if (nModes < 1 || nModes > nSpts) {
+      cerr << "modal2vtu: invalid # of modes in element " << ele << endl;
+      return 1;
+    }
+
+    readBin(inFile, pos_modes.data(), nDims*nSpts);
+    for (int k = 0; k < nFields; k++)
+      readBin(inFile, &U_modes[k*nSpts], nModes);
+
+    /* --- Reconstruct the geometry & primitive variables --- */
+
+    for (int ppt = 0; ppt < nPpts; ppt++) {
+      const double *B = &basis[ppt*nSpts];
+
+      for (int dim = 0; dim < nDims; dim++) {
+        double val = 0;
+        for (int m = 0; m < nSpts; m++)
+          val += B[m] * pos_modes[dim*nSpts+m];
+        pos[ppt*nDims+dim] = val;
+      }
+
+      double *Vp = &V[ppt*nFields];
+      for (int k = 0; k < nFields; k++) {
+        double val = 0;
+        for (int m = 0; m < nModes; m++)
+          val += B[m] * U_modes[k*nSpts+m];
+        Vp[k] = val;
+      }
+
+      if (equation == 1) {
+        double rho = Vp[0];
+        double vSq = 0;
+        for (int dim = 0; dim < nDims; dim++) {
+          Vp[dim+1] /= rho;
+          vSq += Vp[dim+1]*Vp[dim+1];
+        }
+        Vp[nDims+1] = (gamma-1.0)*(Vp[nDims+1] - 0.5*rho*vSq);
+      }
+    }
+
+    /* --- Write the element as one piece, as in writeParaview --- */
+
+    dataFile << "		<Piece NumberOfPoints=\"" << nPpts << "\" NumberOfCells=\"" << nSubCells << "\">" << endl;
+    dataFile << "			<PointData>" << endl;
+
+    dataFile << "				<DataArray type=\"Float32\" Name=\"Density\" format=\"ascii\">" << endl;
+    for (int k = 0; k < nPpts; k++)
+      dataFile << V[k*nFields] << " ";
+    dataFile << endl;
+    dataFile << "				</DataArray>" << endl;
+
+    if (equation == 1) {
+      dataFile << "				<DataArray type=\"Float32\" NumberOfComponents=\"3\" Name=\"Velocity\" format=\"ascii\">" << endl;
+      for (int k = 0; k < nPpts; k++) {
+        dataFile << V[k*nFields+1] << " " << V[k*nFields+2] << " ";
+        if (nDims == 2)
+          dataFile << 0.0 << " ";
+        else
+          dataFile << V[k*nFields+3] << " ";
+      }
+      dataFile << endl;
+      dataFile << "				</DataArray>" << endl;
+
+      dataFile << "				<DataArray type=\"Float32\" Name=\"Pressure\" format=\"ascii\">" << endl;
+      for (int k = 0; k < nPpts; k++)
+        dataFile << V[k*nFields+nDims+1] << " ";
+      dataFile << endl;
+      dataFile << "				</DataArray>" << endl;
+    }
+
+    dataFile << "			</PointData>" << endl;
+
+    dataFile << "			<Points>" << endl;
+    dataFile << "				<DataArray type=\"Float32\" NumberOfComponents=\"3\" format=\"ascii\">" << endl;
+    for (int k = 0; k < nPpts; k++) {
+      for (int dim = 0; dim < nDims; dim++)
+        dataFile << pos[k*nDims+dim] << " ";
+      if (nDims == 2)
+        dataFile << 0.0 << " ";
+    }
+    dataFile << endl;
+    dataFile << "				</DataArray>" << endl;
+    dataFile << "			</Points>" << endl;
+
+    dataFile << "			<Cells>" << endl;
+    dataFile << "				<DataArray type=\"Int32\" Name=\"connectivity\" format=\"ascii\">" << endl;
+    if (nDims == 2) {
+      for (int j = 0; j < nPpts1D-1; j++) {
+        for (int i = 0; i < nPpts1D-1; i++) {
+          dataFile << j*nPpts1D     + i   << " ";
+          dataFile << j*nPpts1D     + i+1 << " ";
+          dataFile << (j+1)*nPpts1D + i+1 << " ";
+          dataFile << (j+1)*nPpts1D + i   << " ";
+          dataFile << endl;
+        }
+      }
+    }
+    else {
+      for (int k = 0; k < nPpts1D-1; k++) {
+        for (int j = 0; j < nPpts1D-1; j++) {
+          for (int i = 0; i < nPpts1D-1; i++) {
+            dataFile << i   + nPpts1D*(j   + nPpts1D*k) << " ";
+            dataFile << i+1 + nPpts1D*(j   + nPpts1D*k) << " ";
+            dataFile << i+1 + nPpts1D*(j+1 + nPpts1D*k) << " ";
+            dataFile << i   + nPpts1D*(j+1 + nPpts1D*k) << " ";
+            dataFile << i   + nPpts1D*(j   + nPpts1D*(k+1)) << " ";
+            dataFile << i+1 + nPpts1D*(j   + nPpts1D*(k+1)) << " ";
+            dataFile << i+1 + nPpts1D*(j+1 + nPpts1D*(k+1)) << " ";
+            dataFile << i   + nPpts1D*(j+1 + nPpts1D*(k+1)) << " ";
+            dataFile << endl;
+          }
+        }
+      }
+    }
+    dataFile << "				</DataArray>" << endl;
+
+    int nvPerCell = (nDims == 2) ? 4 : 8;
+    dataFile << "				<DataArray type=\"Int32\" Name=\"offsets\" format=\"ascii\">" << endl;
+    for (int k = 0; k < nSubCells; k++)
+      dataFile << (k+1)*nvPerCell << " ";
+    dataFile << endl;
+    dataFile << "				</DataArray>" << endl;
+
+    int vtkType = (nDims == 2) ? 9 : 12;
+    dataFile << "				<DataArray type=\"UInt8\" Name=\"types\" format=\"ascii\">" << endl;
+    for (int k = 0; k < nSubCells; k++)
+      dataFile << vtkType << " ";
+    dataFile << endl;
+    dataFile << "				</DataArray>" << endl;
+
+    dataFile << "			</Cells>" << endl;
+    dataFile << "		</Piece>" << endl;
+  }
+
+  dataFile << "	</UnstructuredGrid>" << endl;
+  dataFile << "</VTKFile>" << endl;
+  dataFile.close();
+
+  cout << "modal2vtu: wrote " << nEles << " elements to " << outName << endl;
+
+  return 0;
+}